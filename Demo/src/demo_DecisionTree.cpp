@@ -326,7 +326,7 @@ int main(int argc, char* argv[])
 		{
 			for (uint32_t x = 0; x < navmeshWidth; x++)
 			{
-				VGAIL::NodeData& node = navmesh->getNode(VGAIL::Vec2ui(x, y));
+				VGAIL::NodeData node = navmesh->getNode(VGAIL::Vec2ui(x, y));
 
 				if (y >= 9)
 				{
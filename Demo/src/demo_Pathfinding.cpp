@@ -35,12 +35,12 @@ int main(int argc, char* argv[])
 
 	if (navmesh->getNode(startPosition).state == VGAIL::NodeState::OBSTRUCTABLE)
 	{
-		navmesh->getNode(startPosition).state = VGAIL::NodeState::WALKABLE;
+		navmesh->setWalkable(startPosition);
 	}
 
 	if (navmesh->getNode(targetPosition).state == VGAIL::NodeState::OBSTRUCTABLE)
 	{
-		navmesh->getNode(targetPosition).state = VGAIL::NodeState::WALKABLE;
+		navmesh->setWalkable(targetPosition);
 	}
 
 	std::vector<VGAIL::Vec2ui> path_A;
@@ -91,7 +91,7 @@ int main(int argc, char* argv[])
 		{
 			for (uint32_t x = 0; x < navmeshWidth; x++)
 			{
-				VGAIL::NodeData& node = navmesh->getNode(VGAIL::Vec2ui(x, y));
+				VGAIL::NodeData node = navmesh->getNode(VGAIL::Vec2ui(x, y));
 
 				Rectangle nodeRect = { node.pos.x * gridStride, node.pos.y * gridStride, tileSize, tileSize };
 
@@ -52,7 +52,7 @@ int main(int argc, char* argv[])
 
 	if (navmesh->getNode(workerPosition).state == VGAIL::NodeState::OBSTRUCTABLE)
 	{
-		navmesh->getNode(workerPosition).state = VGAIL::NodeState::WALKABLE;
+		navmesh->setWalkable(workerPosition);
 	}
 
 	VGAIL::Vec2ui homePosition = VGAIL::Vec2ui(3, 2);
@@ -62,7 +62,7 @@ int main(int argc, char* argv[])
 
 	if (navmesh->getNode(homePosition).state == VGAIL::NodeState::OBSTRUCTABLE)
 	{
-		navmesh->getNode(homePosition).state = VGAIL::NodeState::WALKABLE;
+		navmesh->setWalkable(homePosition);
 	}
 
 	Mine* mine1 = new Mine(3, VGAIL::Vec2ui{ 11, 15 });
@@ -82,7 +82,7 @@ int main(int argc, char* argv[])
 	{
 		if (navmesh->getNode(mine->position).state == VGAIL::NodeState::OBSTRUCTABLE)
 		{
-			navmesh->getNode(mine->position).state = VGAIL::NodeState::WALKABLE;
+			navmesh->setWalkable(mine->position);
 		}
 	}
 
@@ -299,7 +299,7 @@ int main(int argc, char* argv[])
 		{
 			for (uint32_t x = 0; x < navmeshWidth; x++)
 			{
-				VGAIL::NodeData& node = navmesh->getNode(VGAIL::Vec2ui(x, y));
+				VGAIL::NodeData node = navmesh->getNode(VGAIL::Vec2ui(x, y));
 
 				if (node.state == VGAIL::NodeState::OBSTRUCTABLE)
 				{
@@ -23,10 +23,10 @@ int main(int argc, char* argv[])
 	VGAIL::Vec2ui targetPosition = VGAIL::Vec2ui(navmeshWidth - 1, navmeshHeight - 1);
 
 	if (navmesh->getNode(startPosition).state == VGAIL::NodeState::OBSTRUCTABLE)
-		navmesh->getNode(startPosition).state = VGAIL::NodeState::WALKABLE;
+		navmesh->setWalkable(startPosition);
 
 	if (navmesh->getNode(targetPosition).state == VGAIL::NodeState::OBSTRUCTABLE)
-		navmesh->getNode(targetPosition).state = VGAIL::NodeState::WALKABLE;
+		navmesh->setWalkable(targetPosition);
 
 	std::cout << ">> Number of nodes: " << navmeshWidth * navmeshHeight << std::endl;
 
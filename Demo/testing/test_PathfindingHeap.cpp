@@ -0,0 +1,160 @@
+/**
+* The Vienna Game AI Library
+*
+* (c) bei Lavinia-Elena Lehaci, University of Vienna, 2024
+*
+*/
+
+#include "ViennaGameAILibrary.hpp"
+#include "../src/Timer.h"
+
+// Explicit neighbor lists of all nodes, as the NavMesh stored them before it derived neighbors from its walkability bitset.
+std::vector<std::vector<uint32_t>> createNeighbors(VGAIL::NavMesh* navmesh)
+{
+	int32_t width = navmesh->getWidth();
+	int32_t height = navmesh->getHeight();
+	std::vector<std::vector<uint32_t>> neighbors(width * height);
+
+	for (int32_t y = 0; y < height; y++)
+	{
+		for (int32_t x = 0; x < width; x++)
+		{
+			for (int32_t v = -1; v <= 1; v++)
+			{
+				for (int32_t u = -1; u <= 1; u++)
+				{
+					if ((u == 0 && v == 0) || x + u < 0 || y + v < 0 || x + u >= width || y + v >= height)
+						continue;
+
+					neighbors[x + y * width].push_back((x + u) + (y + v) * width);
+				}
+			}
+		}
+	}
+
+	return neighbors;
+}
+
+// A* with the previous open set: a std::priority_queue of NodeData copies that keeps duplicate entries per node.
+std::vector<VGAIL::Vec2ui> AStarPriorityQueue(VGAIL::NavMesh* navmesh, const std::vector<std::vector<uint32_t>>& neighbors, VGAIL::Vec2ui start, VGAIL::Vec2ui target, VGAIL::PathSearchContext& context, uint32_t& maxOpenSetSize)
+{
+	uint32_t width = navmesh->getWidth();
+	uint32_t height = navmesh->getHeight();
+	std::priority_queue<VGAIL::NodeData, std::vector<VGAIL::NodeData>, VGAIL::NodeDataComparator> openSet;
+
+	context.beginQuery(width * height);
+
+	uint32_t startIndex = navmesh->getIndex(start);
+	uint32_t targetIndex = navmesh->getIndex(target);
+
+	context.setVisited(startIndex, 0.0f, VGAIL::INVALID_INDEX);
+
+	VGAIL::NodeData startEntry = navmesh->getNode(start);
+	startEntry.g = 0.0f;
+	startEntry.h = 0.0f;
+	openSet.push(startEntry);
+
+	while (openSet.size() > 0)
+	{
+		maxOpenSetSize = std::max(maxOpenSetSize, static_cast<uint32_t>(openSet.size()));
+
+		uint32_t currentIndex = navmesh->getIndex(openSet.top().pos);
+		openSet.pop();
+
+		if (context.isClosed(currentIndex))
+			continue;
+
+		context.close(currentIndex);
+
+		if (currentIndex == targetIndex)
+		{
+			std::vector<VGAIL::Vec2ui> path;
+			for (uint32_t nodeIndex : context.reconstructPath(currentIndex))
+			{
+				path.push_back(navmesh->get2DCoordinates(nodeIndex));
+			}
+			return path;
+		}
+
+		VGAIL::Vec2ui currentPos = navmesh->get2DCoordinates(currentIndex);
+		float currentG = context.getG(currentIndex);
+
+		for (uint32_t neighborIndex : neighbors[currentIndex])
+		{
+			VGAIL::NodeData neighbor = navmesh->getNode(navmesh->get2DCoordinates(neighborIndex));
+
+			if (neighbor.state == VGAIL::NodeState::OBSTRUCTABLE || context.isClosed(neighborIndex))
+				continue;
+
+			bool isDiagonal = neighbor.pos.x != currentPos.x && neighbor.pos.y != currentPos.y;
+			float tentativeG = currentG + (isDiagonal ? std::sqrt(2.0f) : 1.0f);
+
+			if (tentativeG < context.getG(neighborIndex))
+			{
+				context.setVisited(neighborIndex, tentativeG, currentIndex);
+
+				VGAIL::NodeData entry = neighbor;
+				entry.g = tentativeG;
+				entry.h = VGAIL::distance(VGAIL::Vec2f(neighbor.pos.x, neighbor.pos.y), VGAIL::Vec2f(target.x, target.y));
+				openSet.push(entry);
+			}
+		}
+	}
+
+	return {};
+}
+
+int main(int argc, char* argv[])
+{
+	std::vector<uint32_t> navmeshSizes = { 10, 100, 500, 1000 };
+	uint32_t numQueries = 100;
+
+	for (uint32_t navmeshSize : navmeshSizes)
+	{
+		VGAIL::NavMesh* navmesh = new VGAIL::NavMesh(navmeshSize, navmeshSize, 30.0f, 10.0f, 10.0f);
+
+		VGAIL::Vec2ui startPosition = VGAIL::Vec2ui(1, 1);
+		VGAIL::Vec2ui targetPosition = VGAIL::Vec2ui(navmeshSize - 1, navmeshSize - 1);
+
+		if (navmesh->getNode(startPosition).state == VGAIL::NodeState::OBSTRUCTABLE)
+			navmesh->setWalkable(startPosition);
+
+		if (navmesh->getNode(targetPosition).state == VGAIL::NodeState::OBSTRUCTABLE)
+			navmesh->setWalkable(targetPosition);
+
+		std::cout << ">> Number of nodes: " << navmeshSize * navmeshSize << std::endl;
+
+		std::vector<std::vector<uint32_t>> neighbors = createNeighbors(navmesh);
+		VGAIL::PathSearchContext context;
+		Timer timer_Queue("Priority queue time");
+		Timer timer_Heap("Indexed heap time");
+
+		double total_Queue = 0.0;
+		double total_Heap = 0.0;
+		uint32_t maxOpenSetSize = 0;
+		std::vector<VGAIL::Vec2ui> path_Queue;
+		std::vector<VGAIL::Vec2ui> path_Heap;
+
+		for (uint32_t i = 0; i < numQueries; i++)
+		{
+			timer_Queue.start();
+			path_Queue = AStarPriorityQueue(navmesh, neighbors, startPosition, targetPosition, context, maxOpenSetSize);
+			timer_Queue.end();
+			total_Queue += timer_Queue.getDuration();
+
+			timer_Heap.start();
+			path_Heap = navmesh->findPath(startPosition, targetPosition, context);
+			timer_Heap.end();
+			total_Heap += timer_Heap.getDuration();
+		}
+
+		std::cout << ">> Path length (priority queue / indexed heap): " << path_Queue.size() << " / " << path_Heap.size() << std::endl;
+		std::cout << ">> Largest priority queue: " << maxOpenSetSize << " entries" << std::endl;
+		std::cout << ">> Average priority queue: " << total_Queue / numQueries << " microseconds" << std::endl;
+		std::cout << ">> Average indexed heap: " << total_Heap / numQueries << " microseconds" << std::endl;
+
+		delete navmesh;
+	}
+
+	return 0;
+}
@@ -0,0 +1,89 @@
+/**
+* The Vienna Game AI Library
+*
+* (c) bei Lavinia-Elena Lehaci, University of Vienna, 2024
+*
+*/
+
+#include "ViennaGameAILibrary.hpp"
+#include "../src/Timer.h"
+
+// Length of a path under the cost model of the NavMesh, such that all policies are compared on the same scale.
+float pathCost(const std::vector<VGAIL::Vec2ui>& path)
+{
+	float cost = 0.0f;
+	for (size_t i = 1; i < path.size(); i++)
+	{
+		bool isDiagonal = path[i].x != path[i - 1].x && path[i].y != path[i - 1].y;
+		cost += isDiagonal ? std::sqrt(2.0f) : 1.0f;
+	}
+
+	return cost;
+}
+
+template <typename Heuristic>
+void runBenchmark(const std::string& name, VGAIL::NavMesh* navmesh, const std::vector<std::pair<VGAIL::Vec2ui, VGAIL::Vec2ui>>& queries)
+{
+	VGAIL::PathSearchContext context;
+	Timer timer(name);
+
+	double totalTime = 0.0;
+	double totalCost = 0.0;
+	uint64_t totalExpansions = 0;
+
+	for (const auto& [start, target] : queries)
+	{
+		timer.start();
+		std::vector<VGAIL::Vec2ui> path = navmesh->findPath<Heuristic>(start, target, context);
+		timer.end();
+
+		totalTime += timer.getDuration();
+		totalExpansions += context.getNumClosed();
+		totalCost += pathCost(path);
+	}
+
+	std::cout << ">> " << name << ": " << totalTime / queries.size() << " microseconds, "
+		<< totalExpansions / queries.size() << " expansions, "
+		<< totalExpansions / std::max(totalTime, 1.0) << " expansions per microsecond, "
+		<< "average cost " << totalCost / queries.size() << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	std::vector<uint32_t> navmeshSizes = { 100, 500, 1000 };
+	uint32_t numQueries = 50;
+
+	for (uint32_t navmeshSize : navmeshSizes)
+	{
+		VGAIL::NavMesh* navmesh = new VGAIL::NavMesh(navmeshSize, navmeshSize, 30.0f, 10.0f, 10.0f);
+
+		std::mt19937 rng(42);
+		std::uniform_int_distribution<uint32_t> distribution(0, navmeshSize - 1);
+		std::vector<std::pair<VGAIL::Vec2ui, VGAIL::Vec2ui>> queries;
+
+		for (uint32_t i = 0; i < numQueries; i++)
+		{
+			VGAIL::Vec2ui start(distribution(rng), distribution(rng));
+			VGAIL::Vec2ui target(distribution(rng), distribution(rng));
+
+			navmesh->setWalkable(start);
+			navmesh->setWalkable(target);
+			queries.push_back({ start, target });
+		}
+
+		std::cout << ">> Number of nodes: " << navmeshSize * navmeshSize << std::endl;
+
+		runBenchmark<VGAIL::OctileHeuristic>("Octile", navmesh, queries);
+		runBenchmark<VGAIL::IntegerOctileHeuristic>("Integer octile", navmesh, queries);
+		runBenchmark<VGAIL::EuclideanHeuristic>("Euclidean", navmesh, queries);
+		runBenchmark<VGAIL::ManhattanHeuristic>("Manhattan", navmesh, queries);
+		runBenchmark<VGAIL::ZeroHeuristic>("Zero (Dijkstra)", navmesh, queries);
+
+		navmesh->buildLandmarks(8, true, 4);
+		runBenchmark<VGAIL::LandmarkHeuristic>("Landmarks (ALT)", navmesh, queries);
+
+		delete navmesh;
+	}
+
+	return 0;
+}
@@ -0,0 +1,98 @@
+/**
+* The Vienna Game AI Library
+*
+* (c) bei Lavinia-Elena Lehaci, University of Vienna, 2024
+*
+*/
+
+#include "ViennaGameAILibrary.hpp"
+#include "../src/Timer.h"
+
+// A path is valid if it connects the start with the target node through walkable neighbors only.
+bool isValidPath(VGAIL::NavMesh* navmesh, const std::vector<VGAIL::Vec2ui>& path, VGAIL::Vec2ui start, VGAIL::Vec2ui target)
+{
+	if (path.front() != start || path.back() != target)
+		return false;
+
+	for (size_t i = 0; i < path.size(); i++)
+	{
+		if (!navmesh->isWalkable(path[i]))
+			return false;
+
+		if (i > 0 && (std::abs(static_cast<int>(path[i].x) - static_cast<int>(path[i - 1].x)) > 1 ||
+			std::abs(static_cast<int>(path[i].y) - static_cast<int>(path[i - 1].y)) > 1))
+			return false;
+	}
+
+	return true;
+}
+
+// Runs hierarchical queries between all pairs of the given nodes and counts the paths that are missing or invalid.
+uint32_t runQueries(const std::string& name, VGAIL::NavMesh* navmesh, const std::vector<VGAIL::Vec2ui>& nodes)
+{
+	Timer timer(name);
+	double totalTime = 0.0;
+	uint32_t numQueries = 0;
+	uint32_t numInvalid = 0;
+
+	for (VGAIL::Vec2ui start : nodes)
+	{
+		for (VGAIL::Vec2ui target : nodes)
+		{
+			timer.start();
+			std::vector<VGAIL::Vec2ui> path = navmesh->findHierarchicalPath(start, target);
+			timer.end();
+
+			totalTime += timer.getDuration();
+			numQueries++;
+
+			bool isConnected = navmesh->isWalkable(start) && navmesh->isWalkable(target) && navmesh->areConnected(start, target);
+			if (path.empty() ? isConnected : !isValidPath(navmesh, path, start, target))
+				numInvalid++;
+		}
+	}
+
+	std::cout << ">> " << name << ": " << totalTime / numQueries << " microseconds, "
+		<< numInvalid << " of " << numQueries << " paths missing or invalid" << std::endl;
+
+	return numInvalid;
+}
+
+int main(int argc, char* argv[])
+{
+	uint32_t navmeshSize = 40;
+	uint32_t numNodes = 40;
+	uint32_t numEdits = 3;
+
+	VGAIL::NavMesh* navmesh = new VGAIL::NavMesh(navmeshSize, navmeshSize, 30.0f, 10.0f, 10.0f);
+
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<uint32_t> distribution(0, navmeshSize - 1);
+	std::vector<VGAIL::Vec2ui> nodes;
+
+	while (nodes.size() < numNodes)
+	{
+		VGAIL::Vec2ui pos(distribution(rng), distribution(rng));
+		if (navmesh->isWalkable(pos))
+			nodes.push_back(pos);
+	}
+
+	navmesh->buildHierarchy();
+	uint32_t numInvalid = runQueries("Built hierarchy", navmesh, nodes);
+
+	// Block walkable nodes next to the sampled ones, such that the old abstract graph leads through obstacles
+	for (uint32_t i = 0; i < numEdits; i++)
+	{
+		VGAIL::Vec2ui pos = nodes[i * numNodes / numEdits];
+		navmesh->setObstructable(VGAIL::Vec2ui(std::min(pos.x + 1, navmeshSize - 1), pos.y));
+	}
+
+	numInvalid += runQueries("Edited navmesh", navmesh, nodes);
+
+	navmesh->buildHierarchy();
+	numInvalid += runQueries("Rebuilt hierarchy", navmesh, nodes);
+
+	delete navmesh;
+
+	return numInvalid == 0 ? 0 : 1;
+}
@@ -19,10 +19,27 @@
 #include <vector>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <shared_mutex>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <map>
+#include <list>
 #include <atomic>
+#include <cstring>
+#include <span>
+#include <chrono>
+#include <limits>
+#include <bit>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace VGAIL
 {
@@ -32,6 +49,8 @@ namespace VGAIL
     typedef int32_t i32;                            /*!< The 32-bit representation of signed integers. */
     typedef float f32;                              /*!< The 32-bit representation of floating-point numbers. */
 
+    constexpr ui32 INVALID_INDEX = 0xFFFFFFFF;      /*!< Marks a missing node index, e.g. the parent of the start node. */
+
     /**
      * @brief Custom assertion macro.
      *
@@ -359,13 +378,35 @@ namespace VGAIL
     /**
      * @brief Custom struct used in geometric preprocessing.
      *
-     * When geometric preprocessing is used, the navigation mesh is divided into regions, with each region having 
-     * assigned a set of nodes.
+     * When geometric preprocessing is used, the navigation mesh is divided into regions, with each region covering 
+     * a rectangle of nodes.
      */
     struct Region
     {
         ui32 regionID;                              /*!< Region's index within RegionList. */
-        std::vector<ui32> nodes;                    /*!< List of IDs of the Region's assigned nodes. */
+        Vec2ui minPos;                              /*!< The top-left corner of the rectangle covered by the Region. */
+        Vec2ui maxPos;                              /*!< The bottom-right corner of the rectangle covered by the Region. */
+
+        /**
+         * @brief Checks whether a position lies within the rectangle covered by the Region.
+         *
+         * @param pos The 2D position to check.
+         * @return `true` if the position is inside the Region, `false` otherwise.
+         */
+        bool contains(const Vec2ui& pos) const
+        {
+            return pos.x >= minPos.x && pos.x <= maxPos.x && pos.y >= minPos.y && pos.y <= maxPos.y;
+        }
+    };
+
+    /**
+     * @brief Custom struct that represents an edge of the abstract graph used in hierarchical pathfinding.
+     *
+     */
+    struct HierarchyEdge
+    {
+        ui32 target;                                /*!< The ID of the abstract node this edge leads to. */
+        f32 cost;                                   /*!< The cost of the shortest path between the two abstract nodes. */
     };
 
     /**
@@ -437,720 +478,7369 @@ namespace VGAIL
         WALKABLE
     };
 
+    constexpr i32 GRID_DIRECTIONS[8][2] = {         /*!< The offsets `(x, y)` of the 8 neighbors of a NavMesh node. */
+        { -1, -1 }, { 0, -1 }, { 1, -1 },
+        { -1,  0 },            { 1,  0 },
+        { -1,  1 }, { 0,  1 }, { 1,  1 }
+    };
+    constexpr f32 GRID_DIRECTION_COSTS[8] = {       /*!< The costs of the moves to the 8 neighbors, in the order of `GRID_DIRECTIONS`. */
+        1.41421356f, 1.0f, 1.41421356f,
+        1.0f,              1.0f,
+        1.41421356f, 1.0f, 1.41421356f
+    };
+    constexpr uint8_t NO_DIRECTION = 0xFF;          /*!< Marks a missing direction, e.g. of a node without a next hop. */
+
     /**
-     * @brief Custom struct to hold node information.
+     * @brief Gets the index within `GRID_DIRECTIONS` of the move between two neighboring nodes.
      *
+     * @param from The position of the node to move from.
+     * @param to The position of the neighboring node to move to.
+     * @return uint8_t The index of the direction.
      */
-    struct NodeData
+    inline uint8_t getDirection(const Vec2ui& from, const Vec2ui& to)
     {
-        Vec2ui pos;                                 /*!< 2D position of the node. */
-        f32 g;                                      /*!< The cost of the path from the start node to the current node. */
-        f32 h;                                      /*!< The heuristic function. */
-        ui32 regionID;                              /*!< The ID of the region this node is assigned to. */
-        NodeState state;                            /*!< The state of this node. */
+        i32 dx = static_cast<i32>(to.x) - static_cast<i32>(from.x);
+        i32 dy = static_cast<i32>(to.y) - static_cast<i32>(from.y);
+        ui32 index = (dx + 1) + (dy + 1) * 3;
+
+        return static_cast<uint8_t>(index < 4 ? index : index - 1);
+    }
+
+    /**
+     * @brief Checks whether a direction of `GRID_DIRECTIONS` is diagonal.
+     *
+     * @param direction The index of the direction.
+     * @return `true` if the direction is diagonal, `false` otherwise.
+     */
+    constexpr bool isDiagonalDirection(ui32 direction)
+    {
+        // Bits 0, 2, 5 and 7 mark the diagonal directions
+        return (0xA5 >> direction) & 1;
+    }
+
+    /**
+     * @brief Heuristic and cost policy of A* for 8-connected grids: the octile distance.
+     *
+     * Every policy defines the cost of a straight and a diagonal move, estimates the remaining cost from the absolute 
+     * distances `dx` and `dy` on both axes, and states whether the search returns paths that are optimal under the 
+     * cost model of the NavMesh (straight moves cost 1, diagonal moves cost √2). \n
+     * The octile distance is the exact cost of a path without obstacles, thus it is the tightest admissible heuristic 
+     * and needs neither `std::pow` nor `std::sqrt`. It is used by default.
+     */
+    struct OctileHeuristic
+    {
+        static constexpr f32 STRAIGHT_COST = 1.0f;                   /*!< The cost of a horizontal or vertical move. */
+        static constexpr f32 DIAGONAL_COST = 1.41421356f;            /*!< The cost of a diagonal move. */
+        static constexpr bool IS_OPTIMAL = true;                     /*!< Whether the found paths are shortest paths of the NavMesh. */
 
         /**
-         * @brief Constructs a new NodeData object.
+         * @brief Estimates the cost of the path between two nodes.
          *
-         * @param pos 2D position of the node.
-         * @param nodeState State of the node; by default is `walkable`.
+         * @param dx The distance between the nodes on the `x` axis.
+         * @param dy The distance between the nodes on the `y` axis.
+         * @return f32 The estimated cost.
          */
-        NodeData(Vec2ui pos, NodeState nodeState = NodeState::WALKABLE)
-            : pos(pos)
-            , g(INFINITY)
-            , h(INFINITY)
-            , state(nodeState)
-        {}
+        static f32 estimate(ui32 dx, ui32 dy)
+        {
+            return static_cast<f32>(std::max(dx, dy)) + (DIAGONAL_COST - 1.0f) * static_cast<f32>(std::min(dx, dy));
+        }
+    };
+
+    /**
+     * @brief Heuristic and cost policy of A* that uses integer costs: 10 for straight and 14 for diagonal moves.
+     *
+     * All costs are whole numbers, thus they are summed up and compared exactly. Since 14 / 10 only approximates √2, 
+     * a found path may be slightly longer than the shortest path of the NavMesh.
+     */
+    struct IntegerOctileHeuristic
+    {
+        static constexpr f32 STRAIGHT_COST = 10.0f;                  /*!< The cost of a horizontal or vertical move. */
+        static constexpr f32 DIAGONAL_COST = 14.0f;                  /*!< The cost of a diagonal move. */
+        static constexpr bool IS_OPTIMAL = false;                    /*!< Whether the found paths are shortest paths of the NavMesh. */
 
         /**
-         * @brief Calculates the total cost estimate of the most efficient path from the start node to the end node.
+         * @brief Estimates the cost of the path between two nodes.
          *
-         * @return f32 Total cost estimate.
+         * @param dx The distance between the nodes on the `x` axis.
+         * @param dy The distance between the nodes on the `y` axis.
+         * @return f32 The estimated cost.
          */
-        f32 f() const
+        static f32 estimate(ui32 dx, ui32 dy)
         {
-            return g + h;
+            return static_cast<f32>(10 * std::max(dx, dy) + 4 * std::min(dx, dy));
         }
+    };
+
+    /**
+     * @brief Heuristic and cost policy of A* that uses the Euclidean distance.
+     *
+     * Admissible, but lower than the octile distance whenever a path is not straight, thus A* expands more nodes.
+     */
+    struct EuclideanHeuristic
+    {
+        static constexpr f32 STRAIGHT_COST = 1.0f;                   /*!< The cost of a horizontal or vertical move. */
+        static constexpr f32 DIAGONAL_COST = 1.41421356f;            /*!< The cost of a diagonal move. */
+        static constexpr bool IS_OPTIMAL = true;                     /*!< Whether the found paths are shortest paths of the NavMesh. */
 
         /**
-         * @brief Compares this NodeData object to another NodeData object.
+         * @brief Estimates the cost of the path between two nodes.
          *
-         * Compares the `regionID`, `state`, `g` and `h` values of two NodeData objects for equality.
-         *
-         * @param other NodeData to compare against.
-         * @return `true` if the NodeData objects are equal, `false` otherwise.
+         * @param dx The distance between the nodes on the `x` axis.
+         * @param dy The distance between the nodes on the `y` axis.
+         * @return f32 The estimated cost.
          */
-        bool operator==(const NodeData& other)
+        static f32 estimate(ui32 dx, ui32 dy)
         {
-            return pos == other.pos && g == other.g && h == other.h && regionID == other.regionID && state == other.state;
+            f32 x = static_cast<f32>(dx);
+            f32 y = static_cast<f32>(dy);
+            return std::sqrt(x * x + y * y);
         }
     };
 
     /**
-     * @brief Custom struct that compares two NodeData objects in a priority queue.
+     * @brief Heuristic and cost policy of A* that uses the Manhattan distance.
      *
+     * Overestimates the cost of diagonal moves, thus A* expands fewer nodes, but the found paths are not always the 
+     * shortest ones.
      */
-    struct NodeDataComparator
+    struct ManhattanHeuristic
     {
+        static constexpr f32 STRAIGHT_COST = 1.0f;                   /*!< The cost of a horizontal or vertical move. */
+        static constexpr f32 DIAGONAL_COST = 1.41421356f;            /*!< The cost of a diagonal move. */
+        static constexpr bool IS_OPTIMAL = false;                    /*!< Whether the found paths are shortest paths of the NavMesh. */
+
         /**
-         * @brief Compares two NodeData objects based on their `f()` value.
-         *
-         * Used in the A* algorithm when managing the priority queue that contains all nodes to be looked at 
-         * during the search. \n
-         * Whenever a NodeData object is added to the queue, it checks where to put it depending on its `f()` value 
-         * by comparing it to the other objects in the list.
+         * @brief Estimates the cost of the path between two nodes.
          *
-         * @param node1 First NodeData object.
-         * @param node2 Second NodeData object.
-         * @return `true` if the first NodeData object has a higher `f()` value, `false` otherwise.
+         * @param dx The distance between the nodes on the `x` axis.
+         * @param dy The distance between the nodes on the `y` axis.
+         * @return f32 The estimated cost.
          */
-        bool operator()(const NodeData& node1, const NodeData& node2) const
+        static f32 estimate(ui32 dx, ui32 dy)
         {
-            return node1.f() > node2.f();
+            return static_cast<f32>(dx + dy);
         }
     };
 
     /**
-     * @brief Custom navigation mesh created especially for pathfinding.
+     * @brief Heuristic and cost policy of A* without any estimate, which turns A* into Dijkstra's algorithm.
      *
-     * It can be used without pathfinding as well.
      */
-    class NavMesh
+    struct ZeroHeuristic
     {
-    public:
+        static constexpr f32 STRAIGHT_COST = 1.0f;                   /*!< The cost of a horizontal or vertical move. */
+        static constexpr f32 DIAGONAL_COST = 1.41421356f;            /*!< The cost of a diagonal move. */
+        static constexpr bool IS_OPTIMAL = true;                     /*!< Whether the found paths are shortest paths of the NavMesh. */
+
         /**
-         * @brief Constructs a new NavMesh object by creating nodes with random states.
+         * @brief Estimates the cost of the path between two nodes.
          *
-         * @param width The width of the navigation mesh.
-         * @param height The height of the navigation mesh.
-         * @param obstaclePercentage The percentage to limit the amount of nodes with the state `obstructable` 
-         * spawned within the navigation mesh.
-         * @param regionLengthOnX The amount of regions on the `x` axis. Only needed for geometric preprocessing; 
-         * by default it is set to 5.
-         * @param regionLengthOnY The amount of regions on the `y` axis. Only needed for geometric preprocessing; 
-         * by default it is set to 5.
+         * @return f32 Always 0.
          */
-        NavMesh(ui32 width, ui32 height, f32 obstaclePercentage, f32 regionLengthOnX = 5.0f, f32 regionLengthOnY = 5.0f)
-            : m_width(width)
-            , m_height(height)
+        static f32 estimate(ui32, ui32)
         {
-            for (ui32 y = 0; y < m_height; y++)
-            {
-                for (ui32 x = 0; x < m_width; x++)
-                {
-                    NodeData node(Vec2ui{ x, y });
-
-                    auto val = randomFloat(0.0f, 100.0f);
-                    if (obstaclePercentage != 0.0f && val <= obstaclePercentage)
-                    {
-                        node.state = NodeState::OBSTRUCTABLE;
-                    }
-
-                    m_nodes.emplace_back(node);
-                }
-            }
-
-            m_adjList.resize(m_nodes.size(), {});
-            m_neighbors.resize(m_nodes.size(), {});
-
-            for (ui32 i = 0; i < m_nodes.size(); i++)
-            {
-                setNeighbors(i);
-            }
-
-            createRegions(regionLengthOnX, regionLengthOnY);
+            return 0.0f;
         }
+    };
+
+    /**
+     * @brief Heuristic and cost policy of A* that tightens the octile distance with landmarks (ALT).
+     *
+     * `NavMesh::buildLandmarks()` stores the cost of the shortest path from a few landmark nodes to every node. By the
+     * triangle inequality, the cost between two nodes is at least the difference of their costs to any landmark. The
+     * NavMesh uses the largest of these bounds and the octile distance, which is still admissible and consistent, but
+     * far closer to the real cost behind walls and in mazes. \n
+     * Without landmarks, or once they are outdated, it is the same as `OctileHeuristic`.
+     */
+    struct LandmarkHeuristic
+    {
+        static constexpr f32 STRAIGHT_COST = 1.0f;                   /*!< The cost of a horizontal or vertical move. */
+        static constexpr f32 DIAGONAL_COST = 1.41421356f;            /*!< The cost of a diagonal move. */
+        static constexpr bool IS_OPTIMAL = true;                     /*!< Whether the found paths are shortest paths of the NavMesh. */
 
         /**
-         * @brief Constructs a new NavMesh object by loading its data from a file.
+         * @brief Estimates the cost of the path between two nodes without landmarks.
          *
-         * @param filepath The relative path of the file.
-         * @param regionLengthOnX The amount of regions on the `x` axis. Only needed for geometric preprocessing; 
-         * by default it is set to 5.
-         * @param regionLengthOnY The amount of regions on the `y` axis. Only needed for geometric preprocessing; 
-         * by default it is set to 5.
+         * @param dx The distance between the nodes on the `x` axis.
+         * @param dy The distance between the nodes on the `y` axis.
+         * @return f32 The octile distance.
          */
-        NavMesh(const std::string& filepath, f32 regionLengthOnX = 5.0f, f32 regionLengthOnY = 5.0f)
+        static f32 estimate(ui32 dx, ui32 dy)
         {
-            std::ifstream stream(filepath);
-            std::string navmeshData;
+            return OctileHeuristic::estimate(dx, dy);
+        }
+    };
 
-            if (stream.is_open())
-            {
-                std::string line;
-                getline(stream, line);
-                m_width = std::stoi(line);
+    /**
+     * @brief Estimates the cost of the path between two nodes with a heuristic policy.
+     *
+     * @tparam Heuristic The heuristic policy, e.g. `OctileHeuristic`.
+     * @param from The position of the first node.
+     * @param to The position of the second node.
+     * @return f32 The estimated cost.
+     */
+    template <typename Heuristic>
+    f32 estimateCost(const Vec2ui& from, const Vec2ui& to)
+    {
+        ui32 dx = from.x > to.x ? from.x - to.x : to.x - from.x;
+        ui32 dy = from.y > to.y ? from.y - to.y : to.y - from.y;
+        return Heuristic::estimate(dx, dy);
+    }
 
-                getline(stream, line);
-                m_height = std::stoi(line);
+    /**
+     * @brief Search algorithm used by `NavMesh::findPath()`.
+     *
+     * All modes return the full list of cells of an optimal path under the same cost model, where straight moves 
+     * cost 1 and diagonal moves cost √2.
+     */
+    enum PathSearchMode
+    {
+        ASTAR,                                      /*!< Plain A*, expanding every reached node. */
+        JUMP_POINT_SEARCH,                          /*!< Jump Point Search; only expands nodes at which the path can turn. */
+        BIDIRECTIONAL_ASTAR                         /*!< A* that searches from the start and the target node at the same time. */
+    };
 
-                stream >> navmeshData;
-            }
-            else
-            {
-                std::cout << "Could not read file " << filepath << std::endl;
-                return;
-            }
+    /**
+     * @brief State of a path search that is advanced in steps.
+     *
+     */
+    enum PathStatus
+    {
+        QUEUED,                                     /*!< The request waits for its search to start. */
+        SEARCHING,                                  /*!< The search has started but is not finished yet. */
+        FOUND,                                      /*!< The search is finished and a path was found. */
+        NOT_FOUND,                                  /*!< The search is finished and there is no path. */
+        RELEASED                                    /*!< The request is unknown, was cancelled or its result was already collected. */
+    };
 
-            for (ui32 y = 0; y < m_height; y++)
-            {
-                for (ui32 x = 0; x < m_width; x++)
-                {
-                    NodeData node(Vec2ui{ x, y });
+    /**
+     * @brief Custom struct that describes one query of `NavMesh::findPaths()`.
+     *
+     */
+    struct PathRequest
+    {
+        Vec2ui start;                               /*!< The position of the start node. */
+        Vec2ui target;                              /*!< The position of the target node. */
+        PathSearchMode mode = PathSearchMode::ASTAR;    /*!< The search algorithm used if the request is searched on its own. */
+    };
 
-                    char state = navmeshData[getIndex(Vec2ui{ x, y })];
-                    if (state == 'w')
-                    {
-                        node.state = NodeState::WALKABLE;
-                    }
-                    else
-                    {
-                        node.state = NodeState::OBSTRUCTABLE;
-                    }
+    /**
+     * @brief Custom struct that holds the statistics of the path cache of a NavMesh.
+     *
+     */
+    struct PathCacheStats
+    {
+        uint64_t hits = 0;                          /*!< The number of queries answered from the cache. */
+        uint64_t misses = 0;                        /*!< The number of queries that had to be searched. */
+        uint64_t evictions = 0;                     /*!< The number of paths removed to make room for newer ones. */
+        uint64_t invalidations = 0;                 /*!< The number of paths discarded because the navigation mesh changed. */
+    };
 
-                    m_nodes.emplace_back(node);
-                }
-            }
+#ifdef VGAIL_ENABLE_PATH_STATS
+    constexpr bool PATH_STATS_ENABLED = true;       /*!< Whether path queries are instrumented; define `VGAIL_ENABLE_PATH_STATS` before including the library to enable it. */
+#else
+    constexpr bool PATH_STATS_ENABLED = false;      /*!< Whether path queries are instrumented; define `VGAIL_ENABLE_PATH_STATS` before including the library to enable it. */
+#endif
 
-            m_adjList.resize(m_nodes.size(), {});
-            m_neighbors.resize(m_nodes.size(), {});
+    /**
+     * @brief Custom struct that holds the measurements of a single path query.
+     *
+     * Only filled in if `PATH_STATS_ENABLED` is set, see `PathSearchContext::getQueryStats()`.
+     */
+    struct PathQueryStats
+    {
+        Vec2ui start;                               /*!< The position of the start node. */
+        Vec2ui target;                              /*!< The position of the target node. */
+        ui32 numExpanded = 0;                       /*!< The number of nodes closed by all searches of the query. */
+        ui32 numPushes = 0;                         /*!< The number of insertions and decrease-keys of the open sets. */
+        ui32 numPops = 0;                           /*!< The number of nodes taken from the open sets. */
+        ui32 maxOpenSetSize = 0;                    /*!< The largest size an open set reached during the query. */
+        ui32 pathLength = 0;                        /*!< The number of nodes of the found path; 0 if none was found. */
+        f32 duration = 0.0f;                        /*!< The wall time of the query in microseconds. */
+        bool isCacheHit = false;                    /*!< Whether the path was taken from the path cache. */
+    };
 
-            for (ui32 i = 0; i < m_nodes.size(); i++)
-            {
-                setNeighbors(i);
-            }
+    /**
+     * @brief Custom class that counts values in logarithmic buckets to estimate their percentiles.
+     *
+     * Values below 8 get a bucket each. Above, the range of every power of two is split into 8 buckets of equal 
+     * width, thus a percentile is never more than 12.5% above the true value. Adding a value takes constant time and 
+     * the memory is fixed, whatever the number of values.
+     */
+    class StatsHistogram
+    {
+    public:
+        static constexpr ui32 NUM_SUB_BUCKETS = 8;                              /*!< The number of buckets per power of two. */
+        static constexpr ui32 NUM_BUCKETS = NUM_SUB_BUCKETS * (64 - 3 + 1);     /*!< The number of buckets for all 64-bit values. */
 
-            createRegions(regionLengthOnX, regionLengthOnY);
+        /**
+         * @brief Constructs an empty StatsHistogram object.
+         *
+         */
+        StatsHistogram()
+            : m_buckets(NUM_BUCKETS, 0)
+        {
         }
 
         /**
-         * @brief Destroys the NavMesh object.
+         * @brief Adds a value.
          *
+         * @param value The value.
          */
-        ~NavMesh() {}
+        void add(uint64_t value)
+        {
+            m_buckets[getBucket(value)]++;
+            m_count++;
+            m_sum += static_cast<double>(value);
+            m_min = std::min(m_min, value);
+            m_max = std::max(m_max, value);
+        }
 
         /**
-         * @brief Performs geometric preprocessing with optional multithreading.
-         *
-         * a) Multithreaded \n
-         * Each thread receives a part of the already defined regions and is assigned the `preprocessWorker()` method.
+         * @brief Estimates a percentile of the added values.
          *
-         * b) Single-threaded \n
-         * For each node, calculate the shortest path to each region and store it at position `m_adjList[nodeIndex][regionID]`, 
-         * where `nodeIndex` is the index of the node within `m_nodes`, and `regionID` is the ID of the region it found a path to. 
-         * `m_adjList` will then be used to retrieve shortest path within regions.
-         * 
-         * @param multithreading Set to `true` to enable multithreading, `false` otherwise.
-         * @param numThreads The number of threads to use if multithreading is enabled; by default it is set to 4.
+         * @param percentile The percentile between 0 and 100, e.g. 99 for the value that 99% of all values do not 
+         * exceed.
+         * @return uint64_t The upper bound of the bucket the percentile falls into, but at most the largest value; 0 if 
+         * no values were added.
          */
-        void preprocess(bool multithreading = false, ui32 numThreads = 4)
+        uint64_t getPercentile(f32 percentile) const
         {
-            m_isPreprocessed = true;
-            if (multithreading)
-            {
-                std::vector<std::thread> threads;
-                ui32 regionsPerThread = m_regions->regions.size() / numThreads;
+            if (m_count == 0)
+                return 0;
 
-                for (ui32 i = 0; i < numThreads; i++)
-                {
-                    threads.push_back(std::thread(&NavMesh::preprocessWorker, this, i, numThreads, m_nodes, m_regions->regions));
-                }
+            uint64_t rank = static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0f, 100.0f) / 100.0 * m_count));
+            rank = std::max<uint64_t>(rank, 1);
 
-                for (ui32 i = 0; i < threads.size(); i++)
-                {
-                    threads[i].join();
-                }
-            }
-            else
+            uint64_t numValues = 0;
+            for (ui32 bucket = 0; bucket < NUM_BUCKETS; bucket++)
             {
-                for (ui32 i = 0; i < m_nodes.size(); i++)
-                {
-                    // Avoid unavailable nodes
-                    if (m_nodes[i].state == NodeState::OBSTRUCTABLE)
-                        continue;
-
-                    for (Region* R : m_regions->regions)
-                    {
-                        // Ignore the region this node belongs to
-                        if (m_nodes[i].regionID == R->regionID)
-                            continue;
-
-                        std::vector<std::vector<Vec2ui>> paths;
-
-                        // Calculate distances from this node to all nodes in region R
-                        for (ui32 O_tentative : R->nodes)
-                        {
-                            std::vector<Vec2ui> path = findPath(m_nodes[i].pos, m_nodes[O_tentative].pos);
-
-                            if (path.size() > 0)
-                            {
-                                paths.push_back(path);
-                            }
-                        }
-
-                        // No paths found
-                        if (paths.size() == 0)
-                        {
-                            continue;
-                        }
-
-                        // Find shortest path from this node to region R
-                        ui32 bestPathIndex = 0;
-                        for (ui32 j = 1; j < paths.size(); j++)
-                        {
-                            if (paths[j].size() < paths[bestPathIndex].size())
-                            {
-                                bestPathIndex = j;
-                            }
-                        }
-
-                        // Store the shortest path
-                        m_adjList[i][R->regionID] = paths[bestPathIndex];
-                    }
-                }
+                numValues += m_buckets[bucket];
+                if (numValues >= rank)
+                    return std::min(getBucketUpperBound(bucket), m_max);
             }
+
+            return m_max;
         }
 
         /**
-         * @brief Finds the shortest path between two NodeData objects without using geometric preprocessing.
-         *
-         * This method calls the A* algorithm directly and returns the shortest path between two nodes.
+         * @brief Gets the number of added values.
          *
-         * @param start The position of the start node.
-         * @param target The position of the target node.
-         * @return std::vector<Vec2ui> The shortest found path.
+         * @return uint64_t The number of values.
          */
-        std::vector<Vec2ui> findPath(Vec2ui start, Vec2ui target)
+        uint64_t getCount() const
         {
-            return AStar(start, target, m_nodes);
+            return m_count;
         }
 
         /**
-         * @brief Finds the stored path between two nodes.
+         * @brief Gets the smallest added value.
          *
-         * After geometric preprocessing, the shortest path from a node to a region is stored at 
-         * `m_adjList[nodeIndex][regionID]`. \n
-         * 	- If the nodes are in the same region, it simply calls the A* algorithm to find the shortest path 
-         * between them. \n
-         * 	- If they are in separate regions, it first retrieves the shortest path from the start node to the region 
-         * in which the target node exists. If the newly found path's end node is the target, the path is returned. 
-         * Otherwise, A* will run to find the path from this end node to the target node and return it, if found.
-         *
-         * @param start The position of the start node.
-         * @param target The position of the target node.
-         * @return std::vector<Vec2ui> The shortest found path.
+         * @return uint64_t The smallest value, or 0 if no values were added.
          */
-        std::vector<Vec2ui> findPreprocessedPath(Vec2ui start, Vec2ui target)
+        uint64_t getMin() const
         {
-            NodeData& startNode = getNode(start);
-            NodeData& targetNode = getNode(target);
+            return m_count > 0 ? m_min : 0;
+        }
+
+        /**
+         * @brief Gets the largest added value.
+         *
+         * @return uint64_t The largest value, or 0 if no values were added.
+         */
+        uint64_t getMax() const
+        {
+            return m_max;
+        }
+
+        /**
+         * @brief Gets the mean of the added values.
+         *
+         * @return double The mean, or 0 if no values were added.
+         */
+        double getMean() const
+        {
+            return m_count > 0 ? m_sum / m_count : 0.0;
+        }
+
+        /**
+         * @brief Removes all values.
+         *
+         */
+        void clear()
+        {
+            std::fill(m_buckets.begin(), m_buckets.end(), 0);
+            m_count = 0;
+            m_sum = 0.0;
+            m_min = std::numeric_limits<uint64_t>::max();
+            m_max = 0;
+        }
+
+    private:
+        /**
+         * @brief Gets the bucket of a value.
+         *
+         * @param value The value.
+         * @return ui32 The index of the bucket.
+         */
+        static ui32 getBucket(uint64_t value)
+        {
+            if (value < NUM_SUB_BUCKETS)
+                return static_cast<ui32>(value);
+
+            // The three bits below the highest set bit select the bucket within the power of two
+            ui32 exponent = static_cast<ui32>(std::bit_width(value)) - 1;
+            ui32 subBucket = static_cast<ui32>(value >> (exponent - 3)) & (NUM_SUB_BUCKETS - 1);
+
+            return NUM_SUB_BUCKETS + (exponent - 3) * NUM_SUB_BUCKETS + subBucket;
+        }
+
+        /**
+         * @brief Gets the largest value that falls into a bucket.
+         *
+         * @param bucket The index of the bucket.
+         * @return uint64_t The upper bound of the bucket.
+         */
+        static uint64_t getBucketUpperBound(ui32 bucket)
+        {
+            if (bucket < NUM_SUB_BUCKETS)
+                return bucket;
+
+            ui32 exponent = (bucket - NUM_SUB_BUCKETS) / NUM_SUB_BUCKETS + 3;
+            uint64_t subBucket = (bucket - NUM_SUB_BUCKETS) % NUM_SUB_BUCKETS;
+            uint64_t width = uint64_t(1) << (exponent - 3);
+
+            return (NUM_SUB_BUCKETS + subBucket) * width + (width - 1);
+        }
+
+        std::vector<uint64_t> m_buckets;                        /*!< The number of values in each bucket. */
+        uint64_t m_count = 0;                                   /*!< The number of added values. */
+        double m_sum = 0.0;                                     /*!< The sum of the added values. */
+        uint64_t m_min = std::numeric_limits<uint64_t>::max();  /*!< The smallest added value. */
+        uint64_t m_max = 0;                                     /*!< The largest added value. */
+    };
+
+    /**
+     * @brief Custom struct that aggregates the measurements of all path queries of a NavMesh.
+     *
+     * See `NavMesh::getPathStats()`. The aggregates cover all queries since the last reset; resetting them after 
+     * each read gives rolling windows, e.g. one per second.
+     */
+    struct PathStats
+    {
+        uint64_t numQueries = 0;                    /*!< The number of recorded queries. */
+        uint64_t numFound = 0;                      /*!< The number of queries that found a path. */
+        uint64_t numCacheHits = 0;                  /*!< The number of queries answered from the path cache. */
+        StatsHistogram durations;                   /*!< The wall times of the queries in nanoseconds. */
+        StatsHistogram expansions;                  /*!< The numbers of expanded nodes. */
+        StatsHistogram pushes;                      /*!< The numbers of open set insertions and decrease-keys. */
+        StatsHistogram pops;                        /*!< The numbers of nodes taken from the open sets. */
+        StatsHistogram maxOpenSetSizes;             /*!< The peak open set sizes. */
+        StatsHistogram pathLengths;                 /*!< The numbers of nodes of the found paths. */
+        PathQueryStats slowestQuery;                /*!< The measurements of the slowest query. */
+
+        /**
+         * @brief Adds the measurements of a query.
+         *
+         * @param query The measurements.
+         */
+        void record(const PathQueryStats& query)
+        {
+            if (numQueries == 0 || query.duration > slowestQuery.duration)
+                slowestQuery = query;
+
+            numQueries++;
+            numFound += query.pathLength > 0 ? 1 : 0;
+            numCacheHits += query.isCacheHit ? 1 : 0;
+
+            durations.add(static_cast<uint64_t>(query.duration * 1000.0f));
+            expansions.add(query.numExpanded);
+            pushes.add(query.numPushes);
+            pops.add(query.numPops);
+            maxOpenSetSizes.add(query.maxOpenSetSize);
+
+            if (query.pathLength > 0)
+                pathLengths.add(query.pathLength);
+        }
+
+        /**
+         * @brief Gets the share of the queries answered from the path cache.
+         *
+         * @return f32 The hit rate between 0 and 1.
+         */
+        f32 getCacheHitRate() const
+        {
+            return numQueries > 0 ? static_cast<f32>(numCacheHits) / numQueries : 0.0f;
+        }
+    };
+
+    /**
+     * @brief Custom struct that holds the answer to one query of `NavMesh::findPaths()`.
+     *
+     */
+    struct PathResult
+    {
+        std::vector<Vec2ui> path;                   /*!< The shortest path from the start to the target node, if found. */
+        bool found = false;                         /*!< Whether a path was found. */
+    };
+
+    /**
+     * @brief Custom struct to hold node information.
+     *
+     */
+    struct NodeData
+    {
+        Vec2ui pos;                                 /*!< 2D position of the node. */
+        f32 g;                                      /*!< The cost of the path from the start node to the current node. */
+        f32 h;                                      /*!< The heuristic function. */
+        ui32 regionID;                              /*!< The ID of the region this node is assigned to. */
+        NodeState state;                            /*!< The state of this node. */
+
+        /**
+         * @brief Constructs a new NodeData object.
+         *
+         * @param pos 2D position of the node.
+         * @param nodeState State of the node; by default is `walkable`.
+         */
+        NodeData(Vec2ui pos, NodeState nodeState = NodeState::WALKABLE)
+            : pos(pos)
+            , g(INFINITY)
+            , h(INFINITY)
+            , state(nodeState)
+        {}
+
+        /**
+         * @brief Calculates the total cost estimate of the most efficient path from the start node to the end node.
+         *
+         * @return f32 Total cost estimate.
+         */
+        f32 f() const
+        {
+            return g + h;
+        }
+
+        /**
+         * @brief Compares this NodeData object to another NodeData object.
+         *
+         * Compares the `regionID`, `state`, `g` and `h` values of two NodeData objects for equality.
+         *
+         * @param other NodeData to compare against.
+         * @return `true` if the NodeData objects are equal, `false` otherwise.
+         */
+        bool operator==(const NodeData& other)
+        {
+            return pos == other.pos && g == other.g && h == other.h && regionID == other.regionID && state == other.state;
+        }
+    };
+
+    /**
+     * @brief Custom struct that compares two NodeData objects in a priority queue.
+     *
+     */
+    struct NodeDataComparator
+    {
+        /**
+         * @brief Compares two NodeData objects based on their `f()` value.
+         *
+         * Used in the A* algorithm when managing the priority queue that contains all nodes to be looked at 
+         * during the search. \n
+         * Whenever a NodeData object is added to the queue, it checks where to put it depending on its `f()` value 
+         * by comparing it to the other objects in the list.
+         *
+         * @param node1 First NodeData object.
+         * @param node2 Second NodeData object.
+         * @return `true` if the first NodeData object has a higher `f()` value, `false` otherwise.
+         */
+        bool operator()(const NodeData& node1, const NodeData& node2) const
+        {
+            return node1.f() > node2.f();
+        }
+    };
+
+    /**
+     * @brief Custom indexed 4-ary min-heap used as the open set of path searches.
+     *
+     * Stores `(key, nodeIndex)` pairs and remembers the position of every node within the heap, so that each node
+     * is contained at most once and its key can be lowered in place (decrease-key) instead of pushing duplicates. \n
+     * A 4-ary layout halves the depth of the tree compared to a binary heap and keeps the children of a node next
+     * to each other in memory.
+     *
+     * @tparam Key The type of the priorities; must be ordered by `operator<`.
+     */
+    template <typename Key>
+    class BasicIndexedHeap
+    {
+    public:
+        /**
+         * @brief Custom struct that represents an element of the heap.
+         *
+         */
+        struct Entry
+        {
+            Key key;                                /*!< The priority of the node; the lowest key is on top. */
+            ui32 index;                             /*!< The index of the node within the NavMesh. */
+        };
+
+        /**
+         * @brief Removes all entries and makes room for node indices up to `numNodes - 1`.
+         *
+         * Only the positions of the entries still in the heap are reset, thus clearing costs O(heap size) and not
+         * O(numNodes).
+         *
+         * @param numNodes The number of nodes of the navigation mesh that will be searched.
+         */
+        void clear(ui32 numNodes)
+        {
+            for (const Entry& entry : m_entries)
+            {
+                m_positions[entry.index] = INVALID_INDEX;
+            }
+            m_entries.clear();
+            reserve(numNodes);
+        }
+
+        /**
+         * @brief Makes room for node indices up to `numNodes - 1` without removing any entries.
+         *
+         * @param numNodes The number of nodes that can be pushed.
+         */
+        void reserve(ui32 numNodes)
+        {
+            if (m_positions.size() < numNodes)
+            {
+                m_positions.resize(numNodes, INVALID_INDEX);
+            }
+        }
+
+        /**
+         * @brief Checks whether the heap is empty.
+         *
+         * @return `true` if there are no entries, `false` otherwise.
+         */
+        bool empty() const
+        {
+            return m_entries.empty();
+        }
+
+        /**
+         * @brief Gets the number of entries.
+         *
+         * @return ui32 The number of entries in the heap.
+         */
+        ui32 size() const
+        {
+            return static_cast<ui32>(m_entries.size());
+        }
+
+        /**
+         * @brief Checks whether a node is in the heap.
+         *
+         * @param index The index of the node within the NavMesh.
+         * @return `true` if the node is in the heap, `false` otherwise.
+         */
+        bool contains(ui32 index) const
+        {
+            return m_positions[index] != INVALID_INDEX;
+        }
+
+        /**
+         * @brief Gets the entry with the lowest key without removing it.
+         *
+         * @return const Entry& The top entry.
+         */
+        const Entry& top() const
+        {
+            return m_entries[0];
+        }
+
+        /**
+         * @brief Inserts a node or lowers its key if it is already in the heap.
+         *
+         * If the node is already contained with a key lower than or equal to `key`, nothing happens.
+         *
+         * @param index The index of the node within the NavMesh.
+         * @param key The priority of the node.
+         */
+        void push(ui32 index, Key key)
+        {
+            ui32 position = m_positions[index];
+
+            if (position == INVALID_INDEX)
+            {
+                position = static_cast<ui32>(m_entries.size());
+                m_entries.push_back(Entry{ key, index });
+                m_positions[index] = position;
+            }
+            else if (key < m_entries[position].key)
+            {
+                m_entries[position].key = key;
+            }
+            else
+            {
+                return;
+            }
+
+            if constexpr (PATH_STATS_ENABLED)
+            {
+                m_numPushes++;
+                m_maxSize = std::max(m_maxSize, static_cast<ui32>(m_entries.size()));
+            }
+
+            siftUp(position);
+        }
+
+        /**
+         * @brief Inserts a node or changes its key to `key`, whether it is lower or higher than before.
+         *
+         * @param index The index of the node within the NavMesh.
+         * @param key The priority of the node.
+         */
+        void update(ui32 index, Key key)
+        {
+            ui32 position = m_positions[index];
+
+            if (position == INVALID_INDEX)
+            {
+                push(index, key);
+                return;
+            }
+
+            bool isHigher = m_entries[position].key < key;
+            m_entries[position].key = key;
+
+            if constexpr (PATH_STATS_ENABLED)
+                m_numPushes++;
+
+            if (isHigher)
+                siftDown(position);
+            else
+                siftUp(position);
+        }
+
+        /**
+         * @brief Removes a node from the heap, if it is contained.
+         *
+         * @param index The index of the node within the NavMesh.
+         */
+        void remove(ui32 index)
+        {
+            ui32 position = m_positions[index];
+            if (position == INVALID_INDEX)
+                return;
+
+            m_positions[index] = INVALID_INDEX;
+
+            Entry last = m_entries.back();
+            m_entries.pop_back();
+
+            if (position < m_entries.size())
+            {
+                m_entries[position] = last;
+                m_positions[last.index] = position;
+                siftDown(position);
+                siftUp(m_positions[last.index]);
+            }
+        }
+
+        /**
+         * @brief Removes the entry with the lowest key.
+         *
+         * @return ui32 The index of the removed node.
+         */
+        ui32 pop()
+        {
+            ui32 index = m_entries[0].index;
+            m_positions[index] = INVALID_INDEX;
+
+            if constexpr (PATH_STATS_ENABLED)
+                m_numPops++;
+
+            Entry last = m_entries.back();
+            m_entries.pop_back();
+
+            if (!m_entries.empty())
+            {
+                m_entries[0] = last;
+                m_positions[last.index] = 0;
+                siftDown(0);
+            }
+
+            return index;
+        }
+
+        /**
+         * @brief Gets the number of insertions and decrease-keys since the last call to `resetCounters()`.
+         *
+         * Only counted if `PATH_STATS_ENABLED` is set.
+         *
+         * @return ui32 The number of pushes.
+         */
+        ui32 getNumPushes() const
+        {
+            return m_numPushes;
+        }
+
+        /**
+         * @brief Gets the number of removed top entries since the last call to `resetCounters()`.
+         *
+         * Only counted if `PATH_STATS_ENABLED` is set.
+         *
+         * @return ui32 The number of pops.
+         */
+        ui32 getNumPops() const
+        {
+            return m_numPops;
+        }
+
+        /**
+         * @brief Gets the largest number of entries since the last call to `resetCounters()`.
+         *
+         * Only counted if `PATH_STATS_ENABLED` is set.
+         *
+         * @return ui32 The peak size of the heap.
+         */
+        ui32 getMaxSize() const
+        {
+            return m_maxSize;
+        }
+
+        /**
+         * @brief Resets the push, pop and peak size counters.
+         *
+         */
+        void resetCounters()
+        {
+            m_numPushes = 0;
+            m_numPops = 0;
+            m_maxSize = 0;
+        }
+
+    private:
+        /**
+         * @brief Moves an entry towards the root until its parent has a lower or equal key.
+         *
+         * @param position The position of the entry within the heap.
+         */
+        void siftUp(ui32 position)
+        {
+            Entry entry = m_entries[position];
+
+            while (position > 0)
+            {
+                ui32 parent = (position - 1) / 4;
+                if (!(entry.key < m_entries[parent].key))
+                    break;
+
+                m_entries[position] = m_entries[parent];
+                m_positions[m_entries[position].index] = position;
+                position = parent;
+            }
+
+            m_entries[position] = entry;
+            m_positions[entry.index] = position;
+        }
+
+        /**
+         * @brief Moves an entry towards the leaves until all of its children have a higher or equal key.
+         *
+         * @param position The position of the entry within the heap.
+         */
+        void siftDown(ui32 position)
+        {
+            Entry entry = m_entries[position];
+            ui32 count = static_cast<ui32>(m_entries.size());
+
+            while (true)
+            {
+                ui32 firstChild = position * 4 + 1;
+                if (firstChild >= count)
+                    break;
+
+                ui32 lastChild = std::min(firstChild + 4, count);
+                ui32 best = firstChild;
+                for (ui32 child = firstChild + 1; child < lastChild; child++)
+                {
+                    if (m_entries[child].key < m_entries[best].key)
+                        best = child;
+                }
+
+                if (!(m_entries[best].key < entry.key))
+                    break;
+
+                m_entries[position] = m_entries[best];
+                m_positions[m_entries[position].index] = position;
+                position = best;
+            }
+
+            m_entries[position] = entry;
+            m_positions[entry.index] = position;
+        }
+
+    private:
+        std::vector<Entry> m_entries;               /*!< The heap-ordered entries. */
+        std::vector<ui32> m_positions;              /*!< The position of each node within `m_entries`, or `INVALID_INDEX`. */
+        ui32 m_numPushes = 0;                       /*!< The number of insertions and decrease-keys, if counted. */
+        ui32 m_numPops = 0;                         /*!< The number of removed top entries, if counted. */
+        ui32 m_maxSize = 0;                         /*!< The largest number of entries, if counted. */
+    };
+
+    typedef BasicIndexedHeap<f32> IndexedHeap;      /*!< The open set of path searches, ordered by a single cost. */
+
+    /**
+     * @brief Reusable scratch memory for path searches on a NavMesh.
+     *
+     * Holds the per-query data of a search (g-costs, parents and the closed set) outside of the navigation mesh,
+     * so that queries never write to shared node state. \n
+     * Every entry is stamped with the generation of the query that wrote it. Starting a new query only increments
+     * the generation counter, which turns all older entries into "unset" ones, thus no buffer ever needs to be
+     * cleared or reallocated between queries.
+     *
+     * The context also owns the open set of the search, an IndexedHeap whose memory is kept between queries.
+     *
+     * Keep one context per thread and pass it to `NavMesh::findPath()` or `NavMesh::findPreprocessedPath()`.
+     */
+    class PathSearchContext
+    {
+    public:
+        /**
+         * @brief Constructs a new, empty PathSearchContext object.
+         *
+         * The buffers are allocated lazily by the first query.
+         */
+        PathSearchContext() {}
+
+        /**
+         * @brief Prepares the context for a new query.
+         *
+         * Grows the buffers if the navigation mesh has more nodes than the context has seen so far, empties the
+         * open set and advances the generation counter. The buffers are only cleared once the counter wraps around.
+         *
+         * @param numNodes The number of nodes of the navigation mesh that will be searched.
+         */
+        void beginQuery(ui32 numNodes)
+        {
+            if (m_g.size() < numNodes)
+            {
+                m_g.resize(numNodes, INFINITY);
+                m_parents.resize(numNodes, INVALID_INDEX);
+                m_visitedStamps.resize(numNodes, 0);
+                m_closedStamps.resize(numNodes, 0);
+            }
+
+            m_openSet.clear(numNodes);
+            m_numClosed = 0;
+
+            m_generation++;
+            m_closedGeneration++;
+
+            if (m_generation == 0)
+            {
+                std::fill(m_visitedStamps.begin(), m_visitedStamps.end(), 0);
+                m_generation = 1;
+            }
+
+            if (m_closedGeneration == 0)
+            {
+                std::fill(m_closedStamps.begin(), m_closedStamps.end(), 0);
+                m_closedGeneration = 1;
+            }
+        }
+
+        /**
+         * @brief Checks whether a node has been reached during the current query.
+         *
+         * @param index The index of the node within the NavMesh.
+         * @return `true` if the node has a g-cost in the current query, `false` otherwise.
+         */
+        bool isVisited(ui32 index) const
+        {
+            return m_visitedStamps[index] == m_generation;
+        }
+
+        /**
+         * @brief Gets the cost of the best known path from the start node to a node.
+         *
+         * @param index The index of the node within the NavMesh.
+         * @return f32 The g-cost of the node, or `INFINITY` if it has not been reached in the current query.
+         */
+        f32 getG(ui32 index) const
+        {
+            return isVisited(index) ? m_g[index] : INFINITY;
+        }
+
+        /**
+         * @brief Gets the node from which a node has been reached on the best known path.
+         *
+         * @param index The index of the node within the NavMesh.
+         * @return ui32 The index of the parent node, or `INVALID_INDEX` if there is none.
+         */
+        ui32 getParent(ui32 index) const
+        {
+            return isVisited(index) ? m_parents[index] : INVALID_INDEX;
+        }
+
+        /**
+         * @brief Stores a new best known path to a node.
+         *
+         * @param index The index of the node within the NavMesh.
+         * @param g The cost of the path from the start node to this node.
+         * @param parent The index of the node from which this node has been reached.
+         */
+        void setVisited(ui32 index, f32 g, ui32 parent)
+        {
+            m_visitedStamps[index] = m_generation;
+            m_g[index] = g;
+            m_parents[index] = parent;
+        }
+
+        /**
+         * @brief Checks whether a node has already been expanded during the current query.
+         *
+         * @param index The index of the node within the NavMesh.
+         * @return `true` if the node is in the closed set, `false` otherwise.
+         */
+        bool isClosed(ui32 index) const
+        {
+            return m_closedStamps[index] == m_closedGeneration;
+        }
+
+        /**
+         * @brief Adds a node to the closed set of the current query.
+         *
+         * @param index The index of the node within the NavMesh.
+         */
+        void close(ui32 index)
+        {
+            m_closedStamps[index] = m_closedGeneration;
+            m_numClosed++;
+
+            if constexpr (PATH_STATS_ENABLED)
+                m_numCountedClosed++;
+        }
+
+        /**
+         * @brief Empties the closed set while keeping all g-costs, parents and the open set.
+         *
+         * Used by searches that expand nodes again in several passes over the same query.
+         */
+        void clearClosed()
+        {
+            m_closedGeneration++;
+
+            if (m_closedGeneration == 0)
+            {
+                std::fill(m_closedStamps.begin(), m_closedStamps.end(), 0);
+                m_closedGeneration = 1;
+            }
+        }
+
+        /**
+         * @brief Gets the number of nodes expanded during the current query.
+         *
+         * @return ui32 The number of closed nodes.
+         */
+        ui32 getNumClosed() const
+        {
+            return m_numClosed;
+        }
+
+        /**
+         * @brief Gets the open set of the current query.
+         *
+         * @return IndexedHeap& The heap of nodes waiting to be expanded, ordered by their f-cost.
+         */
+        IndexedHeap& getOpenSet()
+        {
+            return m_openSet;
+        }
+
+        /**
+         * @brief Gets a second context for searches that run in two directions at once.
+         *
+         * It is created on first use and kept, thus it does not have to be allocated for every query.
+         *
+         * @return PathSearchContext& The context of the reverse search.
+         */
+        PathSearchContext& getReverseContext()
+        {
+            if (!m_reverseContext)
+                m_reverseContext = std::make_unique<PathSearchContext>();
+
+            return *m_reverseContext;
+        }
+
+        /**
+         * @brief Gets the measurements of the last query of `NavMesh::findPath()`, `NavMesh::findPreprocessedPath()` or 
+         * `NavMesh::findHierarchicalPath()` that used this context.
+         *
+         * Only filled in if `PATH_STATS_ENABLED` is set. Unlike `getNumClosed()`, the counts cover all searches a 
+         * query runs, e.g. both directions of a bidirectional search.
+         *
+         * @return const PathQueryStats& The measurements.
+         */
+        const PathQueryStats& getQueryStats() const
+        {
+            return m_queryStats;
+        }
+
+        /**
+         * @brief Gets a vector that path queries can build paths in before copying or encoding them.
+         *
+         * It keeps its memory between queries, thus writing a path to it does not allocate once it has grown to the 
+         * length of the path.
+         *
+         * @return std::vector<Vec2ui>& The path buffer.
+         */
+        std::vector<Vec2ui>& getPathBuffer()
+        {
+            return m_pathBuffer;
+        }
+
+        /**
+         * @brief Follows the stored parents from a node back to the start node of the current query.
+         *
+         * @param index The index of the last node of the path.
+         * @return std::vector<ui32> The indices of the nodes on the path, starting with the start node.
+         */
+        std::vector<ui32> reconstructPath(ui32 index) const
+        {
+            std::vector<ui32> path;
+
+            while (index != INVALID_INDEX)
+            {
+                path.push_back(index);
+                index = getParent(index);
+            }
+
+            std::reverse(path.begin(), path.end());
+            return path;
+        }
+
+    private:
+        friend class NavMesh;
+
+        ui32 m_generation = 0;                      /*!< The stamp of the current query. */
+        ui32 m_closedGeneration = 0;                /*!< The stamp of the current closed set. */
+        ui32 m_numClosed = 0;                       /*!< The number of nodes closed in the current query. */
+        std::vector<f32> m_g;                       /*!< The g-cost of each node. */
+        std::vector<ui32> m_parents;                /*!< The parent of each node on its best known path. */
+        std::vector<ui32> m_visitedStamps;          /*!< The generation in which each node's g-cost and parent were written. */
+        std::vector<ui32> m_closedStamps;           /*!< The generation in which each node was closed. */
+        IndexedHeap m_openSet;                      /*!< The open set of the current query. */
+        std::unique_ptr<PathSearchContext> m_reverseContext;    /*!< The context of the reverse search of bidirectional queries. */
+        std::vector<Vec2ui> m_pathBuffer;           /*!< The path built by queries that write to a caller-owned buffer. */
+        ui32 m_numCountedClosed = 0;                /*!< The number of closed nodes since the current query started, if counted. */
+        PathQueryStats m_queryStats;                /*!< The measurements of the last instrumented query. */
+    };
+
+    /**
+     * @brief Custom pool of persistent worker threads that process ranges of work items with work stealing.
+     *
+     * Each call to `parallelFor()` splits the items into one contiguous range per worker. A worker takes items from 
+     * the front of its own range, and once it runs out, it steals the back half of the largest remaining range of 
+     * another worker. Uneven work (e.g. regions with many obstacles) is therefore balanced across all workers without 
+     * any central queue.
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * @brief Constructs a new ThreadPool object and starts its worker threads.
+         *
+         * @param numThreads The number of worker threads; at least one is always created.
+         */
+        ThreadPool(ui32 numThreads)
+        {
+            numThreads = std::max(numThreads, 1u);
+
+            for (ui32 i = 0; i < numThreads; i++)
+            {
+                m_ranges.push_back(std::make_unique<WorkRange>());
+            }
+
+            for (ui32 i = 0; i < numThreads; i++)
+            {
+                m_threads.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+            }
+        }
+
+        /**
+         * @brief Destroys the ThreadPool object after its worker threads have finished.
+         *
+         */
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+
+            for (std::thread& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+        /**
+         * @brief Gets the number of worker threads.
+         *
+         * @return ui32 The number of worker threads.
+         */
+        ui32 getNumThreads() const
+        {
+            return static_cast<ui32>(m_threads.size());
+        }
+
+        /**
+         * @brief Calls a task for every item in `[0, numItems)` on the worker threads and waits until all are done.
+         *
+         * The task receives the ID of the worker running it, which lies in `[0, getNumThreads())`, thus callers can 
+         * keep per-worker data such as a PathSearchContext. Concurrent calls are processed one after the other. \n
+         * Only the first `maxWorkers` workers take part, such that a pool can serve calls that ask for fewer threads 
+         * without being recreated.
+         *
+         * @param numItems The number of items.
+         * @param task The function to call with `(workerID, item)`.
+         * @param maxWorkers The maximum number of workers to use; by default all of them.
+         */
+        void parallelFor(ui32 numItems, const std::function<void(ui32, ui32)>& task, ui32 maxWorkers = INVALID_INDEX)
+        {
+            std::lock_guard<std::mutex> callLock(m_callMutex);
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            ui32 numThreads = getNumThreads();
+            ui32 numWorkers = std::clamp(maxWorkers, 1u, numThreads);
+            for (ui32 i = 0; i < numThreads; i++)
+            {
+                std::lock_guard<std::mutex> rangeLock(m_ranges[i]->mutex);
+                m_ranges[i]->begin = i < numWorkers ? static_cast<ui32>(static_cast<uint64_t>(numItems) * i / numWorkers) : 0;
+                m_ranges[i]->end = i < numWorkers ? static_cast<ui32>(static_cast<uint64_t>(numItems) * (i + 1) / numWorkers) : 0;
+            }
+
+            m_task = &task;
+            m_numWorkers = numWorkers;
+            m_activeWorkers = numThreads;
+            m_jobID++;
+            m_wake.notify_all();
+
+            m_done.wait(lock, [this]() { return m_activeWorkers == 0; });
+            m_task = nullptr;
+        }
+
+    private:
+        /**
+         * @brief Custom struct that holds the items a worker still has to process.
+         *
+         */
+        struct WorkRange
+        {
+            std::mutex mutex;                       /*!< Guards the range against thieves. */
+            ui32 begin = 0;                         /*!< The next item to process. */
+            ui32 end = 0;                           /*!< One past the last item to process. */
+        };
+
+        /**
+         * @brief The loop run by each worker thread.
+         *
+         * @param workerID The ID of the worker.
+         */
+        void workerLoop(ui32 workerID)
+        {
+            uint64_t lastJobID = 0;
+
+            while (true)
+            {
+                const std::function<void(ui32, ui32)>* task = nullptr;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_wake.wait(lock, [this, lastJobID]() { return m_stop || m_jobID != lastJobID; });
+
+                    if (m_stop)
+                        return;
+
+                    lastJobID = m_jobID;
+                    task = m_task;
+                }
+
+                // Workers beyond the requested number neither process nor steal items
+                ui32 item;
+                while (workerID < m_numWorkers && takeItem(workerID, item))
+                {
+                    (*task)(workerID, item);
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (--m_activeWorkers == 0)
+                        m_done.notify_one();
+                }
+            }
+        }
+
+        /**
+         * @brief Takes the next item of a worker, stealing from another worker if its own range is empty.
+         *
+         * @param workerID The ID of the worker.
+         * @param item The taken item.
+         * @return `true` if an item was taken, `false` if all ranges are empty.
+         */
+        bool takeItem(ui32 workerID, ui32& item)
+        {
+            WorkRange& own = *m_ranges[workerID];
+            {
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (own.begin < own.end)
+                {
+                    item = own.begin++;
+                    return true;
+                }
+            }
+
+            while (true)
+            {
+                // Pick the worker with the most remaining items as the victim
+                ui32 victim = INVALID_INDEX;
+                ui32 mostRemaining = 0;
+                for (ui32 i = 0; i < m_ranges.size(); i++)
+                {
+                    if (i == workerID)
+                        continue;
+
+                    std::lock_guard<std::mutex> lock(m_ranges[i]->mutex);
+                    if (m_ranges[i]->end - m_ranges[i]->begin > mostRemaining)
+                    {
+                        mostRemaining = m_ranges[i]->end - m_ranges[i]->begin;
+                        victim = i;
+                    }
+                }
+
+                if (victim == INVALID_INDEX)
+                    return false;
+
+                ui32 stolenBegin, stolenEnd;
+                {
+                    WorkRange& range = *m_ranges[victim];
+                    std::lock_guard<std::mutex> lock(range.mutex);
+                    if (range.begin >= range.end)
+                        continue;
+
+                    stolenEnd = range.end;
+                    stolenBegin = range.end - (range.end - range.begin + 1) / 2;
+                    range.end = stolenBegin;
+                }
+
+                item = stolenBegin;
+                {
+                    std::lock_guard<std::mutex> lock(own.mutex);
+                    own.begin = stolenBegin + 1;
+                    own.end = stolenEnd;
+                }
+                return true;
+            }
+        }
+
+    private:
+        std::vector<std::thread> m_threads;                         /*!< The worker threads. */
+        std::vector<std::unique_ptr<WorkRange>> m_ranges;           /*!< The remaining items of each worker. */
+        std::mutex m_callMutex;                                     /*!< Serializes calls to `parallelFor()`. */
+        std::mutex m_mutex;                                         /*!< Guards the job state below. */
+        std::condition_variable m_wake;                             /*!< Wakes the workers when a job starts or the pool stops. */
+        std::condition_variable m_done;                             /*!< Wakes the caller when all workers are done. */
+        const std::function<void(ui32, ui32)>* m_task = nullptr;    /*!< The task of the current job. */
+        uint64_t m_jobID = 0;                                       /*!< Incremented for every job. */
+        ui32 m_activeWorkers = 0;                                   /*!< The number of workers still processing the current job. */
+        ui32 m_numWorkers = 0;                                      /*!< The number of workers taking part in the current job. */
+        bool m_stop = false;                                        /*!< Tells the workers to exit. */
+    };
+
+    /**
+     * @brief Custom read-only view of a whole file.
+     *
+     * On POSIX systems the file is memory-mapped, thus its pages are only loaded once they are accessed and are 
+     * shared between all processes that map the same file. On other systems, it is read into memory at once.
+     */
+    class MappedFile
+    {
+    public:
+        /**
+         * @brief Constructs a new MappedFile object by mapping a file.
+         *
+         * @param filepath The relative path of the file.
+         * @param copyOnWrite Set to `true` to allow changing the mapped content through `getMutableData()`; changes 
+         * are private to this object and never written back to the file.
+         */
+        MappedFile(const std::string& filepath, bool copyOnWrite = false)
+        {
+#if defined(__unix__) || defined(__APPLE__)
+            int file = open(filepath.c_str(), O_RDONLY);
+            if (file == -1)
+                return;
+
+            struct stat fileInfo;
+            if (fstat(file, &fileInfo) == 0 && fileInfo.st_size > 0)
+            {
+                int protection = copyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ;
+                void* data = mmap(nullptr, fileInfo.st_size, protection, MAP_PRIVATE, file, 0);
+                if (data != MAP_FAILED)
+                {
+                    m_data = static_cast<uint8_t*>(data);
+                    m_size = fileInfo.st_size;
+                }
+            }
+            close(file);
+#else
+            std::ifstream stream(filepath, std::ios::binary | std::ios::ate);
+            if (!stream.is_open())
+                return;
+
+            m_buffer.resize(static_cast<size_t>(stream.tellg()));
+            stream.seekg(0);
+            stream.read(reinterpret_cast<char*>(m_buffer.data()), m_buffer.size());
+
+            m_data = m_buffer.data();
+            m_size = m_buffer.size();
+#endif
+        }
+
+        /**
+         * @brief Destroys the MappedFile object and unmaps the file.
+         *
+         */
+        ~MappedFile()
+        {
+#if defined(__unix__) || defined(__APPLE__)
+            if (m_data)
+                munmap(m_data, m_size);
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief Checks whether the file could be opened.
+         *
+         * @return `true` if the file is mapped, `false` otherwise.
+         */
+        bool isOpen() const
+        {
+            return m_data != nullptr;
+        }
+
+        /**
+         * @brief Gets the content of the file.
+         *
+         * @return const uint8_t* The first byte of the file.
+         */
+        const uint8_t* getData() const
+        {
+            return m_data;
+        }
+
+        /**
+         * @brief Gets the content of the file for changing it.
+         *
+         * Only allowed if the file was mapped with `copyOnWrite`.
+         *
+         * @return uint8_t* The first byte of the file.
+         */
+        uint8_t* getMutableData()
+        {
+            return m_data;
+        }
+
+        /**
+         * @brief Gets the size of the file.
+         *
+         * @return size_t The size of the file in bytes.
+         */
+        size_t getSize() const
+        {
+            return m_size;
+        }
+
+    private:
+        uint8_t* m_data = nullptr;                  /*!< The first byte of the mapped file. */
+        size_t m_size = 0;                          /*!< The size of the file in bytes. */
+#if !defined(__unix__) && !defined(__APPLE__)
+        std::vector<uint8_t> m_buffer;              /*!< The content of the file on systems without memory mapping. */
+#endif
+    };
+
+    constexpr ui32 FILE_BYTE_ORDER_MARK = 0x01020304;               /*!< Written into binary file headers; reads differently on machines with another byte order. */
+    constexpr char NAVMESH_FILE_MAGIC[4] = { 'V', 'G', 'N', 'M' };  /*!< The first bytes of a binary NavMesh file. */
+    constexpr ui32 NAVMESH_FILE_VERSION = 3;                        /*!< The version of the binary NavMesh file format. */
+
+    /**
+     * @brief Custom struct that represents the header of a binary NavMesh file.
+     *
+     * The header is followed by the walkability of all nodes, starting at an offset aligned to 8 bytes. It is stored 
+     * as the 64-bit words of a `WalkabilityGrid`, including its border and padding, thus it is loaded with a single 
+     * copy. The regions are rectangles of `regionLengthOnX` x `regionLengthOnY` nodes and are derived from the header.
+     *
+     * All values are stored in the byte order of the machine that wrote the file, which is recorded in `byteOrder`. 
+     * Files written on a machine with a different byte order are rejected.
+     */
+    struct NavMeshFileHeader
+    {
+        char magic[4];                              /*!< Identifies the file; always `VGNM`. */
+        ui32 byteOrder;                             /*!< Always `FILE_BYTE_ORDER_MARK` in the byte order of the writer. */
+        ui32 version;                               /*!< The version of the file format. */
+        ui32 width;                                 /*!< The width of the navigation mesh. */
+        ui32 height;                                /*!< The height of the navigation mesh. */
+        f32 regionLengthOnX;                        /*!< The length of a region on the `x` axis. */
+        f32 regionLengthOnY;                        /*!< The length of a region on the `y` axis. */
+        ui32 reserved;                              /*!< Unused; always 0. */
+        uint64_t walkabilityOffset;                 /*!< The offset of the walkability words from the start of the file. */
+        uint64_t walkabilitySize;                   /*!< The size of the walkability words in bytes. */
+    };
+
+    constexpr char PREPROCESSING_FILE_MAGIC[4] = { 'V', 'G', 'P', 'P' };  /*!< The first bytes of a preprocessing file. */
+    constexpr ui32 PREPROCESSING_FILE_VERSION = 1;                        /*!< The version of the preprocessing file format. */
+
+    /**
+     * @brief Custom struct that represents the header of a file with the results of geometric preprocessing.
+     *
+     * The header is followed by the table of next-hop directions, one byte per node and region, stored region by 
+     * region. The table of each region starts at `tableOffset + regionID * width * height`.
+     */
+    struct PreprocessingFileHeader
+    {
+        char magic[4];                              /*!< Identifies the file; always `VGPP`. */
+        ui32 version;                               /*!< The version of the file format. */
+        ui32 width;                                 /*!< The width of the navigation mesh. */
+        ui32 height;                                /*!< The height of the navigation mesh. */
+        ui32 numRegions;                            /*!< The number of regions. */
+        ui32 reserved;                              /*!< Unused; always 0. */
+        uint64_t gridChecksum;                      /*!< The checksum of the node states and regions the tables were built from. */
+        uint64_t tableOffset;                       /*!< The offset of the tables from the start of the file. */
+    };
+
+    /**
+     * @brief Custom class that stores the direction towards a set of target nodes for every node of a NavMesh.
+     *
+     * A flow field is the result of a single Dijkstra search started at the targets. Afterwards, any number of agents 
+     * heading to the same targets only need to look up the next step at their current position, which takes constant 
+     * time. Flow fields are created with `NavMesh::getFlowField()`.
+     */
+    class FlowField
+    {
+    public:
+        /**
+         * @brief Gets the next position on the shortest path from a position to the closest target.
+         *
+         * @param pos The current position.
+         * @return Vec2ui The next position, or `pos` itself if it is a target or cannot reach any target.
+         */
+        Vec2ui getNextStep(const Vec2ui& pos) const
+        {
+            uint8_t direction = m_directions[pos.x + pos.y * m_width];
+            if (direction == NO_DIRECTION)
+                return pos;
+
+            return Vec2ui(pos.x + GRID_DIRECTIONS[direction][0], pos.y + GRID_DIRECTIONS[direction][1]);
+        }
+
+        /**
+         * @brief Gets the direction of the next step from a position.
+         *
+         * @param pos The current position.
+         * @return uint8_t The index of the direction within `GRID_DIRECTIONS`, or `NO_DIRECTION` if `pos` is a target 
+         * or cannot reach any target.
+         */
+        uint8_t getDirection(const Vec2ui& pos) const
+        {
+            return m_directions[pos.x + pos.y * m_width];
+        }
+
+        /**
+         * @brief Gets the cost of the shortest path from a position to the closest target.
+         *
+         * @param pos The position.
+         * @return f32 The cost of the path, or `INFINITY` if no target can be reached.
+         */
+        f32 getDistance(const Vec2ui& pos) const
+        {
+            return m_distances[pos.x + pos.y * m_width];
+        }
+
+        /**
+         * @brief Checks whether a target can be reached from a position.
+         *
+         * @param pos The position.
+         * @return `true` if there is a path to a target, `false` otherwise.
+         */
+        bool isReachable(const Vec2ui& pos) const
+        {
+            return m_distances[pos.x + pos.y * m_width] != INFINITY;
+        }
+
+        /**
+         * @brief Gets the grid epoch of the NavMesh at the time the flow field was built.
+         *
+         * The flow field is outdated once `NavMesh::getGridEpoch()` returns a different value.
+         *
+         * @return uint64_t The grid epoch.
+         */
+        uint64_t getEpoch() const
+        {
+            return m_epoch;
+        }
+
+    private:
+        friend class NavMesh;
+
+        ui32 m_width = 0;                           /*!< The width of the navigation mesh. */
+        uint64_t m_epoch = 0;                       /*!< The grid epoch the flow field was built at. */
+        std::vector<f32> m_distances;               /*!< The cost of the shortest path from each node to the closest target. */
+        std::vector<uint8_t> m_directions;          /*!< The direction of the next step from each node. */
+    };
+
+    /**
+     * @brief Custom class that stores a path compactly as its start node and the directions of its moves.
+     *
+     * Consecutive moves in the same direction form a run, which is stored in a single byte: the lower 3 bits hold 
+     * the index of the direction within `GRID_DIRECTIONS` and the upper 5 bits the number of moves minus 1. Thus a 
+     * straight line of up to 32 moves takes up one byte instead of 8 bytes per node; longer lines are split into 
+     * several runs. \n
+     * The nodes are decoded on the fly while iterating over the path. `assign()` reuses the memory of the previous 
+     * path, thus an agent that keeps its CompactPath does not allocate once it has held a path of the same length.
+     */
+    class CompactPath
+    {
+    public:
+        static constexpr ui32 MAX_RUN_LENGTH = 32;  /*!< The maximum number of moves stored in one run. */
+
+        /**
+         * @brief Custom forward iterator that decodes the nodes of a CompactPath one after the other.
+         *
+         */
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Vec2ui;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Vec2ui*;
+            using reference = const Vec2ui&;
+
+            /**
+             * @brief Constructs an empty Iterator object.
+             *
+             */
+            Iterator() = default;
+
+            /**
+             * @brief Gets the current node.
+             *
+             * @return const Vec2ui& The position of the node.
+             */
+            const Vec2ui& operator*() const
+            {
+                return m_pos;
+            }
+
+            /**
+             * @brief Accesses the current node.
+             *
+             * @return const Vec2ui* The position of the node.
+             */
+            const Vec2ui* operator->() const
+            {
+                return &m_pos;
+            }
+
+            /**
+             * @brief Moves on to the next node of the path.
+             *
+             * @return Iterator& This iterator.
+             */
+            Iterator& operator++()
+            {
+                m_index++;
+                if (m_numRemainingMoves == 0)
+                    return *this;
+
+                uint8_t direction = *m_run & 7;
+                m_pos.x += GRID_DIRECTIONS[direction][0];
+                m_pos.y += GRID_DIRECTIONS[direction][1];
+
+                if (--m_numRemainingMoves == 0 && ++m_run != m_lastRun)
+                    m_numRemainingMoves = (*m_run >> 3) + 1;
+
+                return *this;
+            }
+
+            /**
+             * @brief Moves on to the next node of the path.
+             *
+             * @return Iterator A copy of this iterator before it was moved.
+             */
+            Iterator operator++(int)
+            {
+                Iterator previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            /**
+             * @brief Checks whether two iterators of the same path point to the same node.
+             *
+             * @param other The other iterator.
+             * @return `true` if both point to the same node, `false` otherwise.
+             */
+            bool operator==(const Iterator& other) const
+            {
+                return m_index == other.m_index;
+            }
+
+        private:
+            friend class CompactPath;
+
+            /**
+             * @brief Constructs a new Iterator object.
+             *
+             * @param run The run of the next move.
+             * @param lastRun The end of the runs.
+             * @param pos The position of the current node.
+             * @param index The index of the current node within the path.
+             */
+            Iterator(const uint8_t* run, const uint8_t* lastRun, Vec2ui pos, ui32 index)
+                : m_run(run), m_lastRun(lastRun), m_pos(pos), m_index(index)
+            {
+                if (m_run != m_lastRun)
+                    m_numRemainingMoves = (*m_run >> 3) + 1;
+            }
+
+            const uint8_t* m_run = nullptr;             /*!< The run of the next move. */
+            const uint8_t* m_lastRun = nullptr;         /*!< The end of the runs. */
+            Vec2ui m_pos;                               /*!< The position of the current node. */
+            ui32 m_index = 0;                           /*!< The index of the current node within the path. */
+            ui32 m_numRemainingMoves = 0;               /*!< The number of moves left in the current run. */
+        };
+
+        /**
+         * @brief Constructs an empty CompactPath object.
+         *
+         */
+        CompactPath() = default;
+
+        /**
+         * @brief Constructs a new CompactPath object by encoding a path.
+         *
+         * @param path The nodes of the path; consecutive nodes must be neighbors.
+         */
+        CompactPath(std::span<const Vec2ui> path)
+        {
+            assign(path);
+        }
+
+        /**
+         * @brief Replaces the stored path by encoding a new one.
+         *
+         * @param path The nodes of the path; consecutive nodes must be neighbors.
+         * @return `true` if the path was encoded, `false` if two consecutive nodes are not neighbors, in which case 
+         * the stored path is empty.
+         */
+        bool assign(std::span<const Vec2ui> path)
+        {
+            clear();
+            if (path.empty())
+                return true;
+
+            for (size_t i = 1; i < path.size(); i++)
+            {
+                ui32 dx = path[i].x > path[i - 1].x ? path[i].x - path[i - 1].x : path[i - 1].x - path[i].x;
+                ui32 dy = path[i].y > path[i - 1].y ? path[i].y - path[i - 1].y : path[i - 1].y - path[i].y;
+                if (dx > 1 || dy > 1 || dx + dy == 0)
+                {
+                    std::cout << "Consecutive nodes of the path are not neighbors!" << std::endl;
+                    clear();
+                    return false;
+                }
+
+                uint8_t direction = getDirection(path[i - 1], path[i]);
+                if (!m_runs.empty() && (m_runs.back() & 7) == direction && (m_runs.back() >> 3) + 1u < MAX_RUN_LENGTH)
+                    m_runs.back() += 1 << 3;
+                else
+                    m_runs.push_back(direction);
+            }
+
+            m_start = path[0];
+            m_numNodes = static_cast<ui32>(path.size());
+            return true;
+        }
+
+        /**
+         * @brief Decodes all nodes of the path.
+         *
+         * @param path Receives the nodes; its previous content is replaced and its memory is reused.
+         */
+        void decode(std::vector<Vec2ui>& path) const
+        {
+            path.assign(begin(), end());
+        }
+
+        /**
+         * @brief Removes the stored path but keeps its memory.
+         *
+         */
+        void clear()
+        {
+            m_runs.clear();
+            m_numNodes = 0;
+        }
+
+        /**
+         * @brief Checks whether a path is stored.
+         *
+         * @return `true` if the path has no nodes, `false` otherwise.
+         */
+        bool empty() const
+        {
+            return m_numNodes == 0;
+        }
+
+        /**
+         * @brief Gets the number of nodes of the path.
+         *
+         * @return ui32 The number of nodes, including the start node.
+         */
+        ui32 size() const
+        {
+            return m_numNodes;
+        }
+
+        /**
+         * @brief Gets the first node of the path.
+         *
+         * @return Vec2ui The position of the start node; only meaningful if the path is not empty.
+         */
+        Vec2ui getStart() const
+        {
+            return m_start;
+        }
+
+        /**
+         * @brief Gets the runs of the path.
+         *
+         * @return const std::vector<uint8_t>& The runs, one byte each.
+         */
+        const std::vector<uint8_t>& getRuns() const
+        {
+            return m_runs;
+        }
+
+        /**
+         * @brief Gets an iterator to the first node of the path.
+         *
+         * @return Iterator The iterator.
+         */
+        Iterator begin() const
+        {
+            return Iterator(m_runs.data(), m_runs.data() + m_runs.size(), m_start, 0);
+        }
+
+        /**
+         * @brief Gets an iterator past the last node of the path.
+         *
+         * @return Iterator The iterator.
+         */
+        Iterator end() const
+        {
+            return Iterator(nullptr, nullptr, m_start, m_numNodes);
+        }
+
+        /**
+         * @brief Gets the memory used by the path.
+         *
+         * @return size_t The size of the object and of its runs in bytes.
+         */
+        size_t getMemoryUsage() const
+        {
+            return sizeof(CompactPath) + m_runs.capacity();
+        }
+
+    private:
+        Vec2ui m_start;                             /*!< The first node of the path. */
+        ui32 m_numNodes = 0;                        /*!< The number of nodes of the path. */
+        std::vector<uint8_t> m_runs;                /*!< The moves of the path, one run of equal directions per byte. */
+    };
+
+    /**
+     * @brief Custom class that stores the walkability of all nodes of a NavMesh as a bitset.
+     *
+     * Each node takes up a single bit. The grid is surrounded by a border of obstructable nodes and every row holds 
+     * `width + 2` bits, so that the 8 neighbors of any node can be read without bounds checks: the three nodes above, 
+     * the two beside and the three below a node each lie next to each other in the bitset. \n
+     * A word of padding at the end allows reading across the last word.
+     */
+    class WalkabilityGrid
+    {
+    public:
+        /**
+         * @brief Constructs an empty WalkabilityGrid object.
+         *
+         */
+        WalkabilityGrid() = default;
+
+        /**
+         * @brief Constructs a new WalkabilityGrid object in which all nodes are obstructable.
+         *
+         * @param width The width of the navigation mesh.
+         * @param height The height of the navigation mesh.
+         */
+        WalkabilityGrid(ui32 width, ui32 height)
+            : m_stride(width + 2)
+        {
+            m_words.assign(getNumWords(width, height), 0);
+        }
+
+        /**
+         * @brief Constructs a new WalkabilityGrid object from the words of another one, e.g. stored in a file.
+         *
+         * @param width The width of the navigation mesh.
+         * @param height The height of the navigation mesh.
+         * @param words The `getNumWords()` words of the bitset, as returned by `getWords()`.
+         */
+        WalkabilityGrid(ui32 width, ui32 height, const uint64_t* words)
+            : m_stride(width + 2)
+            , m_words(words, words + getNumWords(width, height))
+        {}
+
+        /**
+         * @brief Gets the number of 64-bit words of the bitset of a navigation mesh.
+         *
+         * @param width The width of the navigation mesh.
+         * @param height The height of the navigation mesh.
+         * @return size_t The number of words, including the border and the padding.
+         */
+        static size_t getNumWords(ui32 width, ui32 height)
+        {
+            size_t numBits = static_cast<size_t>(width + 2) * (height + 2);
+            return numBits / 64 + 2;
+        }
+
+        /**
+         * @brief Gets the words of the bitset.
+         *
+         * @return const uint64_t* The first word.
+         */
+        const uint64_t* getWords() const
+        {
+            return m_words.data();
+        }
+
+        /**
+         * @brief Sets whether a node is walkable.
+         *
+         * @param x The `x` coordinate of the node.
+         * @param y The `y` coordinate of the node.
+         * @param isWalkable `true` if the node is walkable, `false` otherwise.
+         */
+        void set(ui32 x, ui32 y, bool isWalkable)
+        {
+            size_t bit = getBit(x, y);
+            if (isWalkable)
+                m_words[bit / 64] |= uint64_t(1) << (bit % 64);
+            else
+                m_words[bit / 64] &= ~(uint64_t(1) << (bit % 64));
+        }
+
+        /**
+         * @brief Checks whether a node is walkable.
+         *
+         * @param x The `x` coordinate of the node.
+         * @param y The `y` coordinate of the node.
+         * @return `true` if the node is walkable, `false` otherwise.
+         */
+        bool isWalkable(ui32 x, ui32 y) const
+        {
+            size_t bit = getBit(x, y);
+            return (m_words[bit / 64] >> (bit % 64)) & 1;
+        }
+
+        /**
+         * @brief Gets the walkable neighbors of a node as a bitmask.
+         *
+         * Bit `i` of the mask is set if the neighbor in direction `GRID_DIRECTIONS[i]` exists and is walkable.
+         *
+         * @param x The `x` coordinate of the node.
+         * @param y The `y` coordinate of the node.
+         * @return uint8_t The bitmask of the walkable neighbors.
+         */
+        uint8_t getNeighborMask(ui32 x, ui32 y) const
+        {
+            // The bit of the node is (x + 1) + (y + 1) * stride, thus its top-left neighbor is bit x + y * stride
+            size_t topLeft = getBit(x, y) - m_stride - 1;
+            uint8_t above = readThreeBits(topLeft);
+            uint8_t beside = readThreeBits(topLeft + m_stride);
+            uint8_t below = readThreeBits(topLeft + 2 * static_cast<size_t>(m_stride));
+
+            return static_cast<uint8_t>(above | (beside & 1) << 3 | (beside >> 2) << 4 | below << 5);
+        }
+
+        /**
+         * @brief Gets the memory used by the bitset.
+         *
+         * @return size_t The size of the bitset in bytes.
+         */
+        size_t getMemoryUsage() const
+        {
+            return m_words.size() * sizeof(uint64_t);
+        }
+
+    private:
+        /**
+         * @brief Gets the position of a node within the bitset.
+         *
+         * @param x The `x` coordinate of the node.
+         * @param y The `y` coordinate of the node.
+         * @return size_t The index of the bit.
+         */
+        size_t getBit(ui32 x, ui32 y) const
+        {
+            return (x + 1) + (y + 1) * static_cast<size_t>(m_stride);
+        }
+
+        /**
+         * @brief Reads three consecutive bits of the bitset, which may span two words.
+         *
+         * @param bit The index of the first bit.
+         * @return uint8_t The three bits, starting at the lowest one.
+         */
+        uint8_t readThreeBits(size_t bit) const
+        {
+            size_t word = bit / 64;
+            ui32 shift = bit % 64;
+            uint64_t bits = m_words[word] >> shift;
+            if (shift > 61)
+                bits |= m_words[word + 1] << (64 - shift);
+
+            return static_cast<uint8_t>(bits & 7);
+        }
+
+        ui32 m_stride = 0;                          /*!< The number of bits per row, including the border. */
+        std::vector<uint64_t> m_words;              /*!< The bitset, one bit per node. */
+    };
+
+    /**
+     * @brief Custom navigation mesh created especially for pathfinding.
+     *
+     * It can be used without pathfinding as well.
+     */
+    class NavMesh
+    {
+    public:
+        /**
+         * @brief Constructs a new NavMesh object by creating nodes with random states.
+         *
+         * @param width The width of the navigation mesh.
+         * @param height The height of the navigation mesh.
+         * @param obstaclePercentage The percentage to limit the amount of nodes with the state `obstructable` 
+         * spawned within the navigation mesh.
+         * @param regionLengthOnX The amount of regions on the `x` axis. Only needed for geometric preprocessing; 
+         * by default it is set to 5.
+         * @param regionLengthOnY The amount of regions on the `y` axis. Only needed for geometric preprocessing; 
+         * by default it is set to 5.
+         */
+        NavMesh(ui32 width, ui32 height, f32 obstaclePercentage, f32 regionLengthOnX = 5.0f, f32 regionLengthOnY = 5.0f)
+        {
+            initGrid(width, height);
+
+            // One generator for all nodes; seeding a new one per node would dominate the construction of large maps
+            std::random_device dev;
+            std::mt19937 rng(dev());
+            std::uniform_real_distribution<f32> distribution(0.0f, 100.0f);
+
+            for (ui32 y = 0; y < m_height; y++)
+            {
+                for (ui32 x = 0; x < m_width; x++)
+                {
+                    auto val = distribution(rng);
+                    m_walkability.set(x, y, obstaclePercentage == 0.0f || val > obstaclePercentage);
+                }
+            }
+
+            createRegions(regionLengthOnX, regionLengthOnY);
+            buildComponents();
+        }
+
+        /**
+         * @brief Constructs a new NavMesh object by loading its data from a file.
+         *
+         * Both the text format of `saveToFile()` and the binary format of `saveToBinaryFile()` are supported. Binary 
+         * files are memory-mapped and store their own regions. Their connected components are labeled on the first 
+         * query instead of while loading.
+         *
+         * @param filepath The relative path of the file.
+         * @param regionLengthOnX The amount of regions on the `x` axis. Only needed for geometric preprocessing of 
+         * text files; by default it is set to 5.
+         * @param regionLengthOnY The amount of regions on the `y` axis. Only needed for geometric preprocessing of 
+         * text files; by default it is set to 5.
+         */
+        NavMesh(const std::string& filepath, f32 regionLengthOnX = 5.0f, f32 regionLengthOnY = 5.0f)
+        {
+            {
+                MappedFile file(filepath);
+                if (file.getSize() >= sizeof(NAVMESH_FILE_MAGIC) && std::memcmp(file.getData(), NAVMESH_FILE_MAGIC, sizeof(NAVMESH_FILE_MAGIC)) == 0)
+                {
+                    loadBinaryFile(file, filepath);
+                    return;
+                }
+            }
+
+            std::ifstream stream(filepath);
+            std::string navmeshData;
+
+            if (stream.is_open())
+            {
+                std::string line;
+                getline(stream, line);
+                ui32 width = std::stoi(line);
+
+                getline(stream, line);
+                ui32 height = std::stoi(line);
+
+                stream >> navmeshData;
+                initGrid(width, height);
+            }
+            else
+            {
+                std::cout << "Could not read file " << filepath << std::endl;
+                return;
+            }
+
+            for (ui32 y = 0; y < m_height; y++)
+            {
+                for (ui32 x = 0; x < m_width; x++)
+                {
+                    char state = navmeshData[getIndex(Vec2ui{ x, y })];
+                    m_walkability.set(x, y, state == 'w');
+                }
+            }
+
+            createRegions(regionLengthOnX, regionLengthOnY);
+            buildComponents();
+        }
+
+        /**
+         * @brief Destroys the NavMesh object.
+         *
+         * Stops the background update thread, if it is running.
+         */
+        ~NavMesh()
+        {
+            setBackgroundUpdates(false);
+        }
+
+        /**
+         * @brief Performs geometric preprocessing with optional multithreading.
+         *
+         * The shortest path from a node to a region is the shortest path to the closest node of that region. Since 
+         * the NavMesh is undirected, a single Dijkstra search started from all nodes of a region R at once (one-to-all) 
+         * finds it for every node of the NavMesh in one pass (`preprocessRegion()`). \n
+         * Instead of whole paths, only the direction of the next node on the path towards region R is stored, as one 
+         * byte per node in the flat table `m_nextHops`. The path itself is rebuilt by following these directions.
+         *
+         * a) Multithreaded \n
+         * The regions are distributed over the workers of a ThreadPool, which balances them by work stealing. All 
+         * workers read the same nodes, while each of them searches with its own PathSearchContext and only writes the 
+         * part of `m_nextHops` that belongs to the region it processes. Memory does not grow with the number of threads 
+         * beyond one context per worker.
+         *
+         * b) Single-threaded \n
+         * All regions are processed one after the other.
+         * 
+         * @param multithreading Set to `true` to enable multithreading, `false` otherwise.
+         * @param numThreads The number of threads to use if multithreading is enabled; by default it is set to 4.
+         * @param progressCallback Optional function called with `(processedRegions, totalRegions)` after each region. 
+         * Calls never overlap, but with multithreading they happen on the worker threads.
+         */
+        void preprocess(bool multithreading = false, ui32 numThreads = 4, const std::function<void(ui32, ui32)>& progressCallback = nullptr)
+        {
+            ui32 numRegions = static_cast<ui32>(m_regions->regions.size());
+
+            resetUpdates();
+
+            m_isPreprocessed = true;
+            m_nextHopsFile.reset();
+            m_nextHops.assign(m_regions->regions.size() * getNumNodes(), NO_DIRECTION);
+            m_nextHopData = m_nextHops.data();
+
+            if (multithreading)
+            {
+                std::mutex progressMutex;
+                ui32 processedRegions = 0;
+
+                getThreadPool(numThreads).parallelFor(numRegions, [&](ui32 workerID, ui32 regionIndex) {
+                    preprocessRegion(m_regions->regions[regionIndex], m_workerContexts[workerID], getNextHops(regionIndex));
+
+                    if (progressCallback)
+                    {
+                        std::lock_guard<std::mutex> lock(progressMutex);
+                        progressCallback(++processedRegions, numRegions);
+                    }
+                }, numThreads);
+            }
+            else
+            {
+                for (ui32 regionIndex = 0; regionIndex < numRegions; regionIndex++)
+                {
+                    preprocessRegion(m_regions->regions[regionIndex], m_searchContext, getNextHops(regionIndex));
+
+                    if (progressCallback)
+                        progressCallback(regionIndex + 1, numRegions);
+                }
+            }
+        }
+
+        /**
+         * @brief Rebuilds the preprocessed data of all regions invalidated by `setObstructable()` or `setWalkable()`.
+         *
+         * If background updates are enabled, this only waits until the background thread has rebuilt them.
+         *
+         * @param multithreading Set to `true` to rebuild the regions with multiple threads, `false` otherwise.
+         * @param numThreads The number of threads to use if multithreading is enabled; by default it is set to 4.
+         */
+        void updatePreprocessing(bool multithreading = false, ui32 numThreads = 4)
+        {
+            std::vector<ui32> regions;
+            {
+                std::unique_lock<std::mutex> lock(m_updateMutex);
+
+                if (m_updateThread.joinable())
+                {
+                    m_updateDone.wait(lock, [this]() { return m_updateQueue.empty() && !m_isUpdating; });
+                    return;
+                }
+
+                regions.assign(m_updateQueue.begin(), m_updateQueue.end());
+                m_updateQueue.clear();
+            }
+
+            auto rebuild = [this, &regions](PathSearchContext& context, ui32 i) {
+                preprocessRegion(m_regions->regions[regions[i]], context, getNextHops(regions[i]));
+                m_dirtyRegions[regions[i]].store(false, std::memory_order_release);
+            };
+
+            if (multithreading)
+            {
+                getThreadPool(numThreads).parallelFor(static_cast<ui32>(regions.size()), [this, &rebuild](ui32 workerID, ui32 i) {
+                    rebuild(m_workerContexts[workerID], i);
+                }, numThreads);
+            }
+            else
+            {
+                for (ui32 i = 0; i < regions.size(); i++)
+                {
+                    rebuild(m_searchContext, i);
+                }
+            }
+        }
+
+        /**
+         * @brief Saves the results of geometric preprocessing to a file.
+         *
+         * Together with the tables, a checksum of the node states and regions they were built from is stored, such 
+         * that `loadPreprocessing()` can reject files that do not belong to the navigation mesh. 
+         * Regions invalidated by edits must be rebuilt with `updatePreprocessing()` before saving.
+         *
+         * @param filepath The relative path of the file, including the filename; if the file does not exist, it will 
+         * be created automatically.
+         * @return `true` if the file was written, `false` otherwise.
+         */
+        bool savePreprocessing(const std::string& filepath)
+        {
+            if (!m_isPreprocessed)
+            {
+                std::cout << "Geometric preprocessing has not been performed!" << std::endl;
+                return false;
+            }
+
+            if (getNumDirtyRegions() != 0)
+            {
+                std::cout << "Geometric preprocessing is outdated, call updatePreprocessing() before saving!" << std::endl;
+                return false;
+            }
+
+            PreprocessingFileHeader header = {};
+            std::memcpy(header.magic, PREPROCESSING_FILE_MAGIC, sizeof(header.magic));
+            header.version = PREPROCESSING_FILE_VERSION;
+            header.width = m_width;
+            header.height = m_height;
+            header.numRegions = static_cast<ui32>(m_regions->regions.size());
+            header.gridChecksum = computeGridChecksum();
+            header.tableOffset = sizeof(PreprocessingFileHeader);
+
+            std::ofstream stream(filepath, std::ios::binary);
+            if (!stream.is_open())
+            {
+                std::cout << "Could not write file " << filepath << std::endl;
+                return false;
+            }
+
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            stream.write(reinterpret_cast<const char*>(m_nextHopData), static_cast<size_t>(header.numRegions) * getNumNodes());
+            stream.close();
+
+            return true;
+        }
+
+        /**
+         * @brief Loads the results of geometric preprocessing from a file written by `savePreprocessing()`.
+         *
+         * The file is memory-mapped instead of read, thus loading takes the same time for any table size, and the 
+         * table of a region is only paged in once a path to it is requested. Later edits only copy the pages they 
+         * change and never modify the file. \n
+         * The file is rejected if it was built from different node states or regions.
+         *
+         * @param filepath The relative path of the file.
+         * @return `true` if the file was loaded, `false` otherwise.
+         */
+        bool loadPreprocessing(const std::string& filepath)
+        {
+            auto file = std::make_unique<MappedFile>(filepath, true);
+            if (!file->isOpen())
+            {
+                std::cout << "Could not read file " << filepath << std::endl;
+                return false;
+            }
+
+            PreprocessingFileHeader header;
+            size_t tableSize = m_regions->regions.size() * getNumNodes();
+            if (file->getSize() < sizeof(PreprocessingFileHeader))
+            {
+                std::cout << "Invalid preprocessing file " << filepath << std::endl;
+                return false;
+            }
+            std::memcpy(&header, file->getData(), sizeof(header));
+
+            if (std::memcmp(header.magic, PREPROCESSING_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+                header.version != PREPROCESSING_FILE_VERSION || header.tableOffset + tableSize > file->getSize())
+            {
+                std::cout << "Invalid preprocessing file " << filepath << std::endl;
+                return false;
+            }
+
+            if (header.width != m_width || header.height != m_height || header.numRegions != m_regions->regions.size() ||
+                header.gridChecksum != computeGridChecksum())
+            {
+                std::cout << "Preprocessing file " << filepath << " does not match the navigation mesh" << std::endl;
+                return false;
+            }
+
+            resetUpdates();
+
+            m_isPreprocessed = true;
+            m_nextHops.clear();
+            m_nextHops.shrink_to_fit();
+            m_nextHopData = file->getMutableData() + header.tableOffset;
+            m_nextHopsFile = std::move(file);
+
+            return true;
+        }
+
+        /**
+         * @brief Enables or disables rebuilding invalidated regions on a background thread.
+         *
+         * When enabled, every region invalidated by `setObstructable()` or `setWalkable()` is handed to a background 
+         * thread that runs its one-to-all search again and swaps in the result once it is done. Until then, 
+         * `findPreprocessedPath()` falls back to A* for paths into that region, thus it is always correct. \n
+         * While the background thread searches, edits wait for it to finish its current region.
+         *
+         * Queries and edits must still not be called at the same time from different threads.
+         *
+         * @param enabled Set to `true` to start the background thread, `false` to stop it.
+         */
+        void setBackgroundUpdates(bool enabled)
+        {
+            if (enabled == m_updateThread.joinable())
+                return;
+
+            if (enabled)
+            {
+                m_stopUpdates = false;
+                m_updateThread = std::thread(&NavMesh::updateLoop, this);
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_updateMutex);
+                m_stopUpdates = true;
+            }
+            m_updateWake.notify_all();
+            m_updateThread.join();
+        }
+
+        /**
+         * @brief Gets the number of regions whose preprocessed data is waiting to be rebuilt.
+         *
+         * @return ui32 The number of invalidated regions.
+         */
+        ui32 getNumDirtyRegions()
+        {
+            std::lock_guard<std::mutex> lock(m_updateMutex);
+            return static_cast<ui32>(m_updateQueue.size()) + (m_isUpdating ? 1 : 0);
+        }
+
+        /**
+         * @brief Finds the shortest path between two NodeData objects without using geometric preprocessing.
+         *
+         * This method calls the A* algorithm directly and returns the shortest path between two nodes. \n
+         * Jump Point Search can be selected instead, which returns a path of the same length while expanding far 
+         * fewer nodes in open areas.
+         *
+         * Uses the search context owned by the NavMesh, thus it must not be called from several threads at once.
+         *
+         * @tparam Heuristic The heuristic and cost policy of the search; by default it is `OctileHeuristic`.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param mode The search algorithm to use; by default it is A*.
+         * @return std::vector<Vec2ui> The shortest found path.
+         */
+        template <typename Heuristic = OctileHeuristic>
+        std::vector<Vec2ui> findPath(Vec2ui start, Vec2ui target, PathSearchMode mode = PathSearchMode::ASTAR)
+        {
+            return findPath<Heuristic>(start, target, m_searchContext, mode);
+        }
+
+        /**
+         * @brief Finds the shortest path between two NodeData objects using a caller-owned search context.
+         *
+         * The query only reads the navigation mesh, thus each thread can run its own queries concurrently as long as
+         * it passes its own context.
+         *
+         * The heuristic and the costs of the moves are a compile-time policy of the search (see `OctileHeuristic`), 
+         * e.g. `findPath<ZeroHeuristic>(start, target, context)` runs Dijkstra's algorithm. Paths of policies that are 
+         * not optimal bypass the path cache.
+         *
+         * Queries whose target is not reachable from the start node (see `isReachable()`) return an empty path 
+         * without searching.
+         *
+         * @tparam Heuristic The heuristic and cost policy of the search; by default it is `OctileHeuristic`.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search; keep it between queries to avoid any setup cost.
+         * @param mode The search algorithm to use; by default it is A*.
+         * @return std::vector<Vec2ui> The shortest found path.
+         */
+        template <typename Heuristic = OctileHeuristic>
+        std::vector<Vec2ui> findPath(Vec2ui start, Vec2ui target, PathSearchContext& context, PathSearchMode mode = PathSearchMode::ASTAR)
+        {
+            std::vector<Vec2ui> path;
+            findPath<Heuristic>(start, target, context, path, mode);
+
+            return path;
+        }
+
+        /**
+         * @brief Finds the shortest path between two nodes and writes it to a caller-owned vector.
+         *
+         * Same as `findPath(Vec2ui, Vec2ui, PathSearchContext&, PathSearchMode)`, but the previous content of `path` 
+         * is replaced and its memory is reused. Once the vector and the context have grown to the size of the 
+         * longest path, queries do not allocate any memory.
+         *
+         * @tparam Heuristic The heuristic and cost policy of the search; by default it is `OctileHeuristic`.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search; keep it between queries to avoid any setup cost.
+         * @param path Receives the shortest found path, or an empty list.
+         * @param mode The search algorithm to use; by default it is A*.
+         * @return `true` if a path was found, `false` otherwise.
+         */
+        template <typename Heuristic = OctileHeuristic>
+        bool findPath(Vec2ui start, Vec2ui target, PathSearchContext& context, std::vector<Vec2ui>& path, PathSearchMode mode = PathSearchMode::ASTAR)
+        {
+            return instrumentQuery(start, target, context, path, [&](bool& isCacheHit) {
+                return searchPath<Heuristic>(start, target, context, path, mode, isCacheHit);
+            });
+        }
+
+        /**
+         * @brief Finds the shortest path between two nodes and writes it to a caller-owned buffer.
+         *
+         * The path is first built in the path buffer of the context (see `PathSearchContext::getPathBuffer()`), thus 
+         * no memory is allocated once the context has been used for a path of the same length. If the path does not 
+         * fit, only its first `path.size()` nodes are written, which is enough for agents that only follow the start 
+         * of a path before searching again.
+         *
+         * @tparam Heuristic The heuristic and cost policy of the search; by default it is `OctileHeuristic`.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search; keep it between queries to avoid any setup cost.
+         * @param path The buffer to write the nodes of the path to.
+         * @param mode The search algorithm to use; by default it is A*.
+         * @return ui32 The number of nodes of the whole path, or 0 if no path was found.
+         */
+        template <typename Heuristic = OctileHeuristic>
+        ui32 findPath(Vec2ui start, Vec2ui target, PathSearchContext& context, std::span<Vec2ui> path, PathSearchMode mode = PathSearchMode::ASTAR)
+        {
+            std::vector<Vec2ui>& buffer = context.getPathBuffer();
+            findPath<Heuristic>(start, target, context, buffer, mode);
+
+            std::copy_n(buffer.begin(), std::min(buffer.size(), path.size()), path.begin());
+            return static_cast<ui32>(buffer.size());
+        }
+
+        /**
+         * @brief Finds the shortest path between two nodes and stores it in compact form.
+         *
+         * See `CompactPath`. The path is built in the path buffer of the context and encoded afterwards, thus no 
+         * memory is allocated once the context and `path` have grown to the size of the path.
+         *
+         * @tparam Heuristic The heuristic and cost policy of the search; by default it is `OctileHeuristic`.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search; keep it between queries to avoid any setup cost.
+         * @param path Receives the shortest found path, or an empty path.
+         * @param mode The search algorithm to use; by default it is A*.
+         * @return `true` if a path was found, `false` otherwise.
+         */
+        template <typename Heuristic = OctileHeuristic>
+        bool findPath(Vec2ui start, Vec2ui target, PathSearchContext& context, CompactPath& path, PathSearchMode mode = PathSearchMode::ASTAR)
+        {
+            std::vector<Vec2ui>& buffer = context.getPathBuffer();
+            findPath<Heuristic>(start, target, context, buffer, mode);
+
+            return path.assign(buffer) && !path.empty();
+        }
+
+        /**
+         * @brief Precomputes the landmarks used by `LandmarkHeuristic`.
+         *
+         * The landmarks are spread over the largest connected component: its nodes are split into sectors by their
+         * angle around the center of the component, and the node farthest from the center is picked in each sector.
+         * Landmarks at the border of the map give tight bounds for most pairs of nodes. \n
+         * A Dijkstra search from each landmark then stores its cost to every node, thus the memory is a fixed
+         * `numLandmarks` floats per node. With multithreading, the searches are distributed over the workers of the
+         * ThreadPool, each with its own PathSearchContext.
+         *
+         * Making nodes obstructable keeps the landmarks valid, since paths only get longer. Once a node is made
+         * walkable, `LandmarkHeuristic` falls back to the octile distance until the landmarks are built again.
+         *
+         * @param numLandmarks The number of landmarks; by default it is set to 8.
+         * @param multithreading Set to `true` to run the searches with multiple threads, `false` otherwise.
+         * @param numThreads The number of threads to use if multithreading is enabled; by default it is set to 4.
+         */
+        void buildLandmarks(ui32 numLandmarks = 8, bool multithreading = false, ui32 numThreads = 4)
+        {
+            m_areLandmarksValid = false;
+            m_landmarks = selectLandmarks(numLandmarks);
+            numLandmarks = static_cast<ui32>(m_landmarks.size());
+            m_landmarkDistances.assign(static_cast<size_t>(getNumNodes()) * numLandmarks, INFINITY);
+
+            // Every search writes one column of the node-major table, so that a node's costs are read together
+            auto computeDistances = [this, numLandmarks](ui32 landmark, PathSearchContext& context) {
+                dijkstra({ getIndex(m_landmarks[landmark]) }, context);
+
+                for (ui32 i = 0; i < getNumNodes(); i++)
+                {
+                    if (context.isClosed(i))
+                        m_landmarkDistances[static_cast<size_t>(i) * numLandmarks + landmark] = context.getG(i);
+                }
+            };
+
+            if (multithreading)
+            {
+                getThreadPool(numThreads).parallelFor(numLandmarks, [this, &computeDistances](ui32 workerID, ui32 landmark) {
+                    computeDistances(landmark, m_workerContexts[workerID]);
+                }, numThreads);
+            }
+            else
+            {
+                for (ui32 landmark = 0; landmark < numLandmarks; landmark++)
+                {
+                    computeDistances(landmark, m_searchContext);
+                }
+            }
+
+            m_areLandmarksValid = numLandmarks > 0;
+        }
+
+        /**
+         * @brief Gets the landmarks chosen by `buildLandmarks()`.
+         *
+         * @return const std::vector<Vec2ui>& The positions of the landmarks.
+         */
+        const std::vector<Vec2ui>& getLandmarks() const
+        {
+            return m_landmarks;
+        }
+
+        /**
+         * @brief Sets the maximum number of paths kept by the path cache of `findPath()`.
+         *
+         * The cache stores the result of each query by its start and target node. Every path is tagged with the grid 
+         * epoch it was found at and is discarded instead of returned once a node has changed its state since, thus 
+         * outdated paths are never returned. If the cache is full, the least recently used path is replaced. \n
+         * The cache is disabled by default.
+         *
+         * @param capacity The maximum number of cached paths; 0 disables the cache.
+         */
+        void setPathCacheCapacity(ui32 capacity)
+        {
+            std::lock_guard<std::mutex> lock(m_pathCacheMutex);
+            m_pathCacheCapacity = capacity;
+
+            while (m_pathCacheEntries.size() > capacity)
+            {
+                m_pathCacheIndex.erase(m_pathCacheEntries.back().key);
+                m_pathCacheEntries.pop_back();
+            }
+        }
+
+        /**
+         * @brief Gets the hit and miss statistics of the path cache.
+         *
+         * @return PathCacheStats The statistics since the last reset.
+         */
+        PathCacheStats getPathCacheStats()
+        {
+            std::lock_guard<std::mutex> lock(m_pathCacheMutex);
+            return m_pathCacheStats;
+        }
+
+        /**
+         * @brief Resets the statistics of the path cache.
+         *
+         */
+        void resetPathCacheStats()
+        {
+            std::lock_guard<std::mutex> lock(m_pathCacheMutex);
+            m_pathCacheStats = PathCacheStats();
+        }
+
+        typedef std::function<void(const PathQueryStats& stats)> SlowQueryCallback; /*!< Receives the measurements of a slow query. */
+
+        /**
+         * @brief Gets the aggregated measurements of all path queries since the last reset.
+         *
+         * Queries of `findPath()`, `findPreprocessedPath()` and `findHierarchicalPath()` are recorded, from all 
+         * threads. The measurements of a single query are available through `PathSearchContext::getQueryStats()`. 
+         *
+         * Path queries are only instrumented if `VGAIL_ENABLE_PATH_STATS` is defined before the library is included 
+         * (see `PATH_STATS_ENABLED`); otherwise no query is recorded and the instrumentation costs nothing.
+         *
+         * @return PathStats A copy of the aggregates.
+         */
+        PathStats getPathStats()
+        {
+            std::lock_guard<std::mutex> lock(m_pathStatsMutex);
+            return m_pathStats;
+        }
+
+        /**
+         * @brief Resets the aggregated measurements of the path queries.
+         *
+         * Reading and resetting the aggregates in fixed intervals gives rolling statistics.
+         *
+         */
+        void resetPathStats()
+        {
+            std::lock_guard<std::mutex> lock(m_pathStatsMutex);
+            m_pathStats = PathStats();
+        }
+
+        /**
+         * @brief Sets a callback that receives the measurements of every query that takes at least a given time.
+         *
+         * The callback is invoked on the thread that ran the query, right after it. It is only invoked if 
+         * `PATH_STATS_ENABLED` is set.
+         *
+         * @param thresholdMicroseconds The minimum wall time of a reported query in microseconds.
+         * @param callback The callback; an empty function disables the reports.
+         */
+        void setSlowQueryCallback(f32 thresholdMicroseconds, SlowQueryCallback callback)
+        {
+            std::lock_guard<std::mutex> lock(m_pathStatsMutex);
+            m_slowQueryThreshold = thresholdMicroseconds;
+            m_slowQueryCallback = std::move(callback);
+        }
+
+        /**
+         * @brief Starts an A* search that is advanced in steps with `continuePathSearch()`.
+         *
+         * The whole state of the search is kept in the context, thus several searches can be in progress at once, 
+         * each with its own context.
+         *
+         * @param start The position of the start node.
+         * @param context The scratch memory that holds the state of the search.
+         */
+        void beginPathSearch(Vec2ui start, PathSearchContext& context)
+        {
+            context.beginQuery(getNumNodes());
+
+            ui32 startNodeIndex = getIndex(start);
+            context.setVisited(startNodeIndex, 0.0f, INVALID_INDEX);
+            context.getOpenSet().push(startNodeIndex, 0.0f);
+        }
+
+        /**
+         * @brief Advances an A* search started with `beginPathSearch()`.
+         *
+         * Expands nodes until the search is finished or the budget is used up. The search sees the node states at the 
+         * time each node is expanded, thus it should be restarted if the navigation mesh changes in between.
+         *
+         * @param target The position of the target node; must be the same for all steps of a search.
+         * @param context The scratch memory that holds the state of the search.
+         * @param expansionBudget The maximum number of nodes to expand; reduced by the number of expanded nodes.
+         * @param path Receives the shortest path once it has been found.
+         * @return PathStatus `SEARCHING` if the search is not finished yet, `FOUND` or `NOT_FOUND` otherwise.
+         */
+        PathStatus continuePathSearch(Vec2ui target, PathSearchContext& context, ui32& expansionBudget, std::vector<Vec2ui>& path)
+        {
+            return expandAStar(target, context, expansionBudget, path);
+        }
+
+        /**
+         * @brief Finds the shortest paths of a batch of requests in parallel.
+         *
+         * The requests are spread over the worker threads of the NavMesh, each with its own search context, and the 
+         * answer to `requests[i]` is written to `results[i]`. \n
+         * Requests that share the same walkable target are answered together by a single Dijkstra search started at 
+         * the target, which stops once all of their start nodes have been reached. This is only done if the area 
+         * covered by that search (a disk around the target reaching the farthest start node) is estimated to be 
+         * smaller than the areas covered by the separate searches. All other requests are searched on their own with 
+         * the algorithm given by their `mode`.
+         *
+         * The NavMesh must not be changed while the batch runs.
+         *
+         * @param requests The start and target of each query.
+         * @param results The buffer to write the results to; must hold at least as many elements as `requests`.
+         * @param numThreads The number of threads to use; by default it is set to 4.
+         */
+        void findPaths(std::span<const PathRequest> requests, std::span<PathResult> results, ui32 numThreads = 4)
+        {
+            if (results.size() < requests.size())
+            {
+                std::cout << "The result buffer is smaller than the number of path requests!" << std::endl;
+                return;
+            }
+
+            // Group the requests by target, such that requests to the same target can share one search
+            std::vector<std::vector<ui32>> groups;
+            std::unordered_map<ui32, ui32> groupIDs;
+
+            for (ui32 i = 0; i < requests.size(); i++)
+            {
+                const PathRequest& request = requests[i];
+                bool canShare = areConnected(request.start, request.target);
+
+                if (!canShare)
+                {
+                    groups.push_back({ i });
+                    continue;
+                }
+
+                auto [it, isNew] = groupIDs.try_emplace(getIndex(request.target), static_cast<ui32>(groups.size()));
+                if (isNew)
+                    groups.push_back({});
+
+                groups[it->second].push_back(i);
+            }
+
+            // Split up groups whose shared search would expand more nodes than their separate searches
+            for (ui32 groupIndex = 0; groupIndex < groups.size(); groupIndex++)
+            {
+                std::vector<ui32>& group = groups[groupIndex];
+                if (group.size() < 2)
+                    continue;
+
+                f32 maxDistance = 0.0f;
+                f32 separateArea = 0.0f;
+                for (ui32 requestIndex : group)
+                {
+                    f32 distance = euclidean(requests[requestIndex].start, requests[requestIndex].target);
+                    maxDistance = std::max(maxDistance, distance);
+                    separateArea += distance * distance * 0.5f;
+                }
+
+                f32 sharedArea = std::min(PI * maxDistance * maxDistance, static_cast<f32>(getNumNodes()));
+                if (sharedArea <= separateArea)
+                    continue;
+
+                std::vector<ui32> separateRequests(group.begin() + 1, group.end());
+                group.resize(1);
+
+                for (ui32 requestIndex : separateRequests)
+                {
+                    groups.push_back({ requestIndex });
+                }
+            }
+
+            getThreadPool(numThreads).parallelFor(static_cast<ui32>(groups.size()), [&](ui32 workerID, ui32 groupIndex) {
+                const std::vector<ui32>& group = groups[groupIndex];
+                PathSearchContext& context = m_workerContexts[workerID];
+
+                if (group.size() == 1)
+                {
+                    const PathRequest& request = requests[group[0]];
+                    PathResult& result = results[group[0]];
+
+                    result.found = findPath(request.start, request.target, context, result.path, request.mode);
+                    return;
+                }
+
+                std::vector<ui32> startNodes;
+                for (ui32 requestIndex : group)
+                {
+                    startNodes.push_back(getIndex(requests[requestIndex].start));
+                }
+
+                dijkstra({ getIndex(requests[group[0]].target) }, context, startNodes);
+
+                // Parents point towards the target, thus following them from a start node yields its path in order
+                for (ui32 requestIndex : group)
+                {
+                    PathResult& result = results[requestIndex];
+                    ui32 nodeIndex = getIndex(requests[requestIndex].start);
+
+                    result.path.clear();
+                    result.found = context.isClosed(nodeIndex);
+
+                    while (result.found && nodeIndex != INVALID_INDEX)
+                    {
+                        result.path.push_back(get2DCoordinates(nodeIndex));
+                        nodeIndex = context.getParent(nodeIndex);
+                    }
+                }
+            }, numThreads);
+        }
+
+        /**
+         * @brief Gets the flow field towards a single target node.
+         *
+         * See `getFlowField(const std::vector<Vec2ui>&)`.
+         *
+         * @param target The position of the target node.
+         * @return std::shared_ptr<const FlowField> The flow field.
+         */
+        std::shared_ptr<const FlowField> getFlowField(Vec2ui target)
+        {
+            return getFlowField(std::vector<Vec2ui>{ target });
+        }
+
+        /**
+         * @brief Gets the flow field towards the closest of a set of target nodes.
+         *
+         * Flow fields are cached per set of targets and reused until a node changes its state. If the cache is full, 
+         * the least recently used flow field is replaced. Flow fields that are still held by the caller stay valid 
+         * after they have been replaced, but may be outdated (see `FlowField::getEpoch()`).
+         *
+         * @param targets The positions of the target nodes; obstructable targets are ignored.
+         * @return std::shared_ptr<const FlowField> The flow field.
+         */
+        std::shared_ptr<const FlowField> getFlowField(const std::vector<Vec2ui>& targets)
+        {
+            std::vector<ui32> targetIndices;
+            for (const Vec2ui& target : targets)
+            {
+                ui32 targetIndex = getIndex(target);
+                if (isWalkable(targetIndex))
+                    targetIndices.push_back(targetIndex);
+            }
+
+            std::sort(targetIndices.begin(), targetIndices.end());
+            targetIndices.erase(std::unique(targetIndices.begin(), targetIndices.end()), targetIndices.end());
+
+            std::lock_guard<std::mutex> lock(m_flowFieldMutex);
+            uint64_t epoch = m_gridEpoch.load();
+
+            auto it = m_flowFieldCache.find(targetIndices);
+            if (it != m_flowFieldCache.end() && it->second.field->getEpoch() == epoch)
+            {
+                it->second.lastUse = ++m_flowFieldUseCount;
+                return it->second.field;
+            }
+
+            if (it == m_flowFieldCache.end() && m_flowFieldCache.size() >= m_flowFieldCacheCapacity)
+            {
+                auto leastRecentlyUsed = std::min_element(m_flowFieldCache.begin(), m_flowFieldCache.end(), [](const auto& a, const auto& b) {
+                    return a.second.lastUse < b.second.lastUse;
+                });
+                m_flowFieldCache.erase(leastRecentlyUsed);
+            }
+
+            auto field = std::make_shared<FlowField>();
+            field->m_width = m_width;
+            field->m_epoch = epoch;
+            field->m_distances.resize(getNumNodes());
+            field->m_directions.resize(getNumNodes());
+
+            dijkstra(targetIndices, m_flowFieldContext);
+
+            for (ui32 i = 0; i < getNumNodes(); i++)
+            {
+                ui32 parent = m_flowFieldContext.getParent(i);
+                field->m_distances[i] = m_flowFieldContext.isClosed(i) ? m_flowFieldContext.getG(i) : INFINITY;
+                field->m_directions[i] = parent == INVALID_INDEX ? NO_DIRECTION : getDirection(get2DCoordinates(i), get2DCoordinates(parent));
+            }
+
+            if (m_flowFieldCacheCapacity > 0)
+                m_flowFieldCache[targetIndices] = { field, ++m_flowFieldUseCount };
+
+            return field;
+        }
+
+        /**
+         * @brief Sets the maximum number of flow fields kept by `getFlowField()`.
+         *
+         * @param capacity The maximum number of cached flow fields; 0 disables the cache.
+         */
+        void setFlowFieldCacheCapacity(ui32 capacity)
+        {
+            std::lock_guard<std::mutex> lock(m_flowFieldMutex);
+            m_flowFieldCacheCapacity = capacity;
+            m_flowFieldCache.clear();
+        }
+
+        /**
+         * @brief Gets the grid epoch, which is incremented every time a node changes its state.
+         *
+         * Results that were computed at a different epoch may be outdated.
+         *
+         * @return uint64_t The grid epoch.
+         */
+        uint64_t getGridEpoch() const
+        {
+            return m_gridEpoch.load();
+        }
+
+        /**
+         * @brief Finds the stored path between two nodes.
+         *
+         * After geometric preprocessing, the direction of the next node on the shortest path from a node to a region 
+         * is stored in `m_nextHops`. \n
+         * 	- If the nodes are in the same region, it simply calls the A* algorithm to find the shortest path 
+         * between them. \n
+         * 	- If they are in separate regions, it first follows the stored directions from the start node until it 
+         * reaches the region in which the target node exists. If the node reached is the target, the path is returned. 
+         * Otherwise, A* will run to find the path from this end node to the target node and return it, if found.
+         *
+         * Uses the search context owned by the NavMesh, thus it must not be called from several threads at once.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @return std::vector<Vec2ui> The shortest found path.
+         */
+        std::vector<Vec2ui> findPreprocessedPath(Vec2ui start, Vec2ui target)
+        {
+            return findPreprocessedPath(start, target, m_searchContext);
+        }
+
+        /**
+         * @brief Finds the stored path between two nodes using a caller-owned search context.
+         *
+         * See `findPreprocessedPath(Vec2ui, Vec2ui)`. The context is used for the A* searches within the target
+         * region.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search; keep it between queries to avoid any setup cost.
+         * @return std::vector<Vec2ui> The shortest found path.
+         */
+        std::vector<Vec2ui> findPreprocessedPath(Vec2ui start, Vec2ui target, PathSearchContext& context)
+        {
+            std::vector<Vec2ui> path;
+            findPreprocessedPath(start, target, context, path);
+
+            return path;
+        }
+
+        /**
+         * @brief Finds the stored path between two nodes and writes it to a caller-owned vector.
+         *
+         * See `findPreprocessedPath(Vec2ui, Vec2ui)`. The previous content of `path` is replaced and its memory is 
+         * reused. The stored directions are followed twice: once to find the node at which the path enters the 
+         * target region, and once to write the nodes in front of the path within the region, so that no second 
+         * vector is needed.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search; keep it between queries to avoid any setup cost.
+         * @param path Receives the shortest found path, or an empty list.
+         * @return `true` if a path was found, `false` otherwise.
+         */
+        bool findPreprocessedPath(Vec2ui start, Vec2ui target, PathSearchContext& context, std::vector<Vec2ui>& path)
+        {
+            return instrumentQuery(start, target, context, path, [&](bool& isCacheHit) {
+                return searchPreprocessedPath(start, target, context, path, isCacheHit);
+            });
+        }
+
+        /**
+         * @brief Finds the stored path between two nodes and writes it to a caller-owned buffer.
+         *
+         * See `findPath(Vec2ui, Vec2ui, PathSearchContext&, std::span<Vec2ui>, PathSearchMode)` for how paths that do 
+         * not fit are handled.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search; keep it between queries to avoid any setup cost.
+         * @param path The buffer to write the nodes of the path to.
+         * @return ui32 The number of nodes of the whole path, or 0 if no path was found.
+         */
+        ui32 findPreprocessedPath(Vec2ui start, Vec2ui target, PathSearchContext& context, std::span<Vec2ui> path)
+        {
+            std::vector<Vec2ui>& buffer = context.getPathBuffer();
+            findPreprocessedPath(start, target, context, buffer);
+
+            std::copy_n(buffer.begin(), std::min(buffer.size(), path.size()), path.begin());
+            return static_cast<ui32>(buffer.size());
+        }
+
+        /**
+         * @brief Finds the stored path between two nodes and stores it in compact form.
+         *
+         * See `CompactPath`.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search; keep it between queries to avoid any setup cost.
+         * @param path Receives the shortest found path, or an empty path.
+         * @return `true` if a path was found, `false` otherwise.
+         */
+        bool findPreprocessedPath(Vec2ui start, Vec2ui target, PathSearchContext& context, CompactPath& path)
+        {
+            std::vector<Vec2ui>& buffer = context.getPathBuffer();
+            findPreprocessedPath(start, target, context, buffer);
+
+            return path.assign(buffer) && !path.empty();
+        }
+
+        /**
+         * @brief Builds the abstract graph used by hierarchical pathfinding (HPA*).
+         *
+         * The regions created for geometric preprocessing are used as clusters. Along the border of each pair of 
+         * adjacent regions, every run of nodes that can be crossed becomes an entrance, and the nodes on both sides 
+         * of it become abstract nodes connected by an inter-region edge. \n
+         * Within each region, the costs of the shortest paths between all of its abstract nodes are computed once 
+         * and cached as intra-region edges.
+         *
+         * The abstract graph only grows with the number of region borders, thus, unlike `preprocess()`, it can be 
+         * built for maps with millions of nodes. It has to be rebuilt after the NavMesh has been edited; until then, 
+         * `findHierarchicalPath()` falls back to A*.
+         *
+         * @param multithreading Set to `true` to compute the intra-region edges with multiple threads, `false` otherwise.
+         * @param numThreads The number of threads to use if multithreading is enabled; by default it is set to 4.
+         */
+        void buildHierarchy(bool multithreading = false, ui32 numThreads = 4)
+        {
+            m_hierarchyEpoch = m_gridEpoch.load();
+            m_hierarchyNodeIDs.assign(getNumNodes(), INVALID_INDEX);
+            m_hierarchyCells.clear();
+            m_hierarchyEdges.clear();
+            m_regionEntrances.assign(m_regions->regions.size(), {});
+
+            // Entrances between horizontally, vertically and diagonally adjacent regions
+            for (ui32 ry = 0; ry < m_regions->sizeY; ry++)
+            {
+                for (ui32 rx = 0; rx < m_regions->sizeX; rx++)
+                {
+                    const Region* region = m_regions->regions[m_regions->getRegionID(Vec2ui(rx, ry))];
+
+                    if (rx + 1 < m_regions->sizeX)
+                    {
+                        createEntrances(Vec2ui(region->maxPos.x, region->minPos.y), Vec2ui(0, 1), Vec2ui(1, 0), region->maxPos.y - region->minPos.y + 1);
+                    }
+
+                    if (ry + 1 < m_regions->sizeY)
+                    {
+                        createEntrances(Vec2ui(region->minPos.x, region->maxPos.y), Vec2ui(1, 0), Vec2ui(0, 1), region->maxPos.x - region->minPos.x + 1);
+                    }
+
+                    if (ry + 1 < m_regions->sizeY)
+                    {
+                        // Corners can only be crossed diagonally if both nodes next to the diagonal are obstacles
+                        i32 x = static_cast<i32>(region->maxPos.x);
+                        i32 y = static_cast<i32>(region->maxPos.y);
+                        if (rx + 1 < m_regions->sizeX && isWalkable(x, y) && isWalkable(x + 1, y + 1) && !isWalkable(x + 1, y) && !isWalkable(x, y + 1))
+                        {
+                            addHierarchyTransition(getIndex(Vec2ui(x, y)), getIndex(Vec2ui(x + 1, y + 1)), std::sqrt(2.0f));
+                        }
+
+                        x = static_cast<i32>(region->minPos.x);
+                        if (rx > 0 && isWalkable(x, y) && isWalkable(x - 1, y + 1) && !isWalkable(x - 1, y) && !isWalkable(x, y + 1))
+                        {
+                            addHierarchyTransition(getIndex(Vec2ui(x, y)), getIndex(Vec2ui(x - 1, y + 1)), std::sqrt(2.0f));
+                        }
+                    }
+                }
+            }
+
+            // Intra-region edges between all abstract nodes of the same region
+            ui32 numRegions = static_cast<ui32>(m_regions->regions.size());
+
+            if (multithreading)
+            {
+                getThreadPool(numThreads).parallelFor(numRegions, [this](ui32 workerID, ui32 regionIndex) {
+                    connectRegionEntrances(m_regions->regions[regionIndex], m_workerContexts[workerID]);
+                }, numThreads);
+            }
+            else
+            {
+                for (ui32 regionIndex = 0; regionIndex < numRegions; regionIndex++)
+                {
+                    connectRegionEntrances(m_regions->regions[regionIndex], m_searchContext);
+                }
+            }
+
+            m_isHierarchyBuilt = true;
+        }
+
+        /**
+         * @brief Finds a path between two nodes using the abstract graph built by `buildHierarchy()`.
+         *
+         * Uses the search context owned by the NavMesh, thus it must not be called from several threads at once.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @return std::vector<Vec2ui> The found path.
+         */
+        std::vector<Vec2ui> findHierarchicalPath(Vec2ui start, Vec2ui target)
+        {
+            return findHierarchicalPath(start, target, m_searchContext);
+        }
+
+        /**
+         * @brief Finds a path between two nodes using the abstract graph built by `buildHierarchy()`.
+         *
+         * The start and target nodes are temporarily connected to the abstract nodes of their regions, then A* runs 
+         * on the abstract graph. The resulting route is refined into nodes by searching within one region per 
+         * abstract edge. If both nodes are in the same region, a search limited to that region is tried first. \n
+         * The returned path is close to, but not always exactly, the shortest one. If the NavMesh has been edited 
+         * since `buildHierarchy()`, the abstract graph is outdated and A* is used instead.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the searches.
+         * @return std::vector<Vec2ui> The found path.
+         */
+        std::vector<Vec2ui> findHierarchicalPath(Vec2ui start, Vec2ui target, PathSearchContext& context)
+        {
+            std::vector<Vec2ui> path;
+            instrumentQuery(start, target, context, path, [&](bool& isCacheHit) {
+                return searchHierarchicalPath(start, target, context, path, isCacheHit);
+            });
+
+            return path;
+        }
+
+        /**
+         * @brief Saves the structure of a navigation mesh to a file.
+         *
+         * The file will consist of 3 main lines: the first one will represent the width, the second one will be the 
+         * height and the third will be the pattern. \n
+         * 
+         * Example: \n
+         *      10 \n
+         *      1 \n
+         *      oowowowoww \n
+         * Where `o` stands for the `obstructable` state, and `w` for `walkable`.
+         *
+         * @param filepath The relative path of the file, including the filename; if the file does not exist, it will 
+         * be created automatically.
+         */
+        void saveToFile(const std::string& filepath)
+        {
+            std::ofstream stream(filepath);
+            stream << m_width << '\n';
+            stream << m_height << '\n';
+            for (ui32 i = 0; i < getNumNodes(); i++)
+            {
+                if (isWalkable(i))
+                    stream << "w";
+                else
+                    stream << "o";
+            }
+            stream.close();
+        }
+
+        /**
+         * @brief Saves the navigation mesh to a binary file.
+         *
+         * The file consists of a `NavMeshFileHeader`, followed by the walkability bitset exactly as it is kept in 
+         * memory. Such a file is loaded by the file constructor with a single copy, without visiting the nodes.
+         *
+         * @param filepath The relative path of the file, including the filename; if the file does not exist, it will 
+         * be created automatically.
+         */
+        void saveToBinaryFile(const std::string& filepath)
+        {
+            NavMeshFileHeader header = {};
+            std::memcpy(header.magic, NAVMESH_FILE_MAGIC, sizeof(header.magic));
+            header.byteOrder = FILE_BYTE_ORDER_MARK;
+            header.version = NAVMESH_FILE_VERSION;
+            header.width = m_width;
+            header.height = m_height;
+            header.regionLengthOnX = m_regionLengthOnX;
+            header.regionLengthOnY = m_regionLengthOnY;
+            header.walkabilityOffset = sizeof(NavMeshFileHeader);
+            header.walkabilitySize = WalkabilityGrid::getNumWords(m_width, m_height) * sizeof(uint64_t);
+
+            std::ofstream stream(filepath, std::ios::binary);
+            if (!stream.is_open())
+            {
+                std::cout << "Could not write file " << filepath << std::endl;
+                return;
+            }
+
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            stream.write(reinterpret_cast<const char*>(m_walkability.getWords()), header.walkabilitySize);
+            stream.close();
+        }
+
+        /**
+         * @brief Sets the state of a NodeData object to `obstructable`.
+         *
+         * Keeps all precomputed data up to date, thus the state of nodes should only be changed through this method 
+         * and `setWalkable()`.
+         *
+         * @param pos The 2D position of the NodeData object.
+         */
+        void setObstructable(Vec2ui pos)
+        {
+            ui32 index = getIndex(pos);
+            if (m_walkability.isWalkable(pos.x, pos.y))
+            {
+                {
+                    std::unique_lock<std::shared_mutex> lock(m_stateMutex);
+                    m_walkability.set(pos.x, pos.y, false);
+                    updateComponents(index);
+                }
+                onNodeChanged(index);
+            }
+        }
+
+        /**
+         * @brief Sets the state of a NodeData object to `walkable`.
+         *
+         * Keeps all precomputed data up to date, thus the state of nodes should only be changed through this method 
+         * and `setObstructable()`.
+         *
+         * @param pos The 2D position of the NodeData object.
+         */
+        void setWalkable(Vec2ui pos)
+        {
+            ui32 index = getIndex(pos);
+            if (!m_walkability.isWalkable(pos.x, pos.y))
+            {
+                {
+                    std::unique_lock<std::shared_mutex> lock(m_stateMutex);
+                    m_walkability.set(pos.x, pos.y, true);
+                    updateComponents(index);
+                }
+                onNodeChanged(index);
+            }
+        }
+
+        /**
+         * @brief Gets the width of the navigation mesh.
+         *
+         * @return ui32 Width of the navigation mesh.
+         */
+        ui32 getWidth()
+        {
+            return m_width;
+        }
+
+        /**
+         * @brief Gets the height of the navigation mesh.
+         *
+         * @return ui32 Height of the navigation mesh.
+         */
+        ui32 getHeight()
+        {
+            return m_height;
+        }
+
+        /**
+         * @brief Gets the 2D coordinates of a NodeData object.
+         *
+         * @param index The index of the NodeData object within the NavMesh.
+         * @return Vec2ui 2D coordinates of the NodeData object.
+         */
+        Vec2ui get2DCoordinates(ui32 index) const
+        {
+            ui32 x = index % m_width;
+            ui32 y = (index - x) / m_width;
+            return Vec2ui(x, y);
+        }
+
+        /**
+         * @brief Gets the index of a NodeData object within the NavMesh.
+         *
+         * @param pos The 2D coordinates of the NodeData object.
+         * @return ui32 The index of the NodeData object.
+         */
+        ui32 getIndex(Vec2ui pos) const
+        {
+            return pos.x + pos.y * m_width;
+        }
+
+        /**
+         * @brief Gets the number of nodes of the navigation mesh.
+         *
+         * @return ui32 The number of nodes.
+         */
+        ui32 getNumNodes() const
+        {
+            return m_width * m_height;
+        }
+
+        /**
+         * @brief Gets a NodeData object based on its 2D coordinates.
+         *
+         * The NavMesh does not store NodeData objects, but only the walkability of each node as a single bit and its 
+         * region ID. The returned object is assembled from them, thus the state of a node has to be changed through 
+         * `setWalkable()` and `setObstructable()`.
+         *
+         * @param pos The 2D coordinates of the NodeData object.
+         * @return NodeData The NodeData object.
+         */
+        NodeData getNode(Vec2ui pos) const
+        {
+            NodeData node(pos, m_walkability.isWalkable(pos.x, pos.y) ? NodeState::WALKABLE : NodeState::OBSTRUCTABLE);
+            node.regionID = getRegionID(pos);
+            return node;
+        }
+
+        /**
+         * @brief Checks whether a node is walkable.
+         *
+         * @param pos The 2D coordinates of the node.
+         * @return `true` if the node is walkable, `false` otherwise.
+         */
+        bool isWalkable(Vec2ui pos) const
+        {
+            return m_walkability.isWalkable(pos.x, pos.y);
+        }
+
+        /**
+         * @brief Gets the walkable neighbors of a node as a bitmask.
+         *
+         * Bit `i` is set if the neighbor in direction `GRID_DIRECTIONS[i]` exists and is walkable. Moving to it costs 
+         * `GRID_DIRECTION_COSTS[i]`.
+         *
+         * @param pos The 2D position of the node.
+         * @return uint8_t The bitmask of the walkable neighbors.
+         */
+        uint8_t getNeighborMask(const Vec2ui& pos) const
+        {
+            return m_walkability.getNeighborMask(pos.x, pos.y);
+        }
+
+        /**
+         * @brief Gets the ID of the region a node is assigned to.
+         *
+         * @param pos The 2D coordinates of the node.
+         * @return ui32 The ID of the region.
+         */
+        ui32 getRegionID(Vec2ui pos) const
+        {
+            return m_regionColumns[pos.x] + m_regionRows[pos.y];
+        }
+
+        /**
+         * @brief Checks whether two nodes are connected by a path.
+         *
+         * Every walkable node is labeled with the connected component it belongs to. The labels are kept up to date
+         * by `setWalkable()` and `setObstructable()`, thus the check only compares two labels.
+         *
+         * @param a The 2D coordinates of the first node.
+         * @param b The 2D coordinates of the second node.
+         * @return `true` if both nodes are walkable and connected by a path, `false` otherwise.
+         */
+        bool areConnected(Vec2ui a, Vec2ui b) const
+        {
+            ensureComponents();
+            ui32 componentID = getComponentID(getIndex(a));
+            return componentID != INVALID_INDEX && componentID == getComponentID(getIndex(b));
+        }
+
+        /**
+         * @brief Checks whether a search from the start node can reach the target node.
+         *
+         * Unlike `areConnected()`, the start node may be obstructable, since the searches are allowed to leave it.
+         * All path searches call this first, thus they return at once if the target is unreachable.
+         *
+         * @param start The 2D coordinates of the start node.
+         * @param target The 2D coordinates of the target node.
+         * @return `true` if the target node is reachable, `false` otherwise.
+         */
+        bool isReachable(Vec2ui start, Vec2ui target) const
+        {
+            if (start == target)
+                return true;
+
+            ensureComponents();
+            ui32 startNodeIndex = getIndex(start);
+            ui32 targetComponentID = getComponentID(getIndex(target));
+            if (targetComponentID == INVALID_INDEX)
+                return false;
+
+            if (m_walkability.isWalkable(start.x, start.y))
+                return getComponentID(startNodeIndex) == targetComponentID;
+
+            for (uint8_t mask = getNeighborMask(start); mask != 0; mask &= mask - 1)
+            {
+                ui32 direction = std::countr_zero(mask);
+                if (getComponentID(startNodeIndex + m_directionOffsets[direction]) == targetComponentID)
+                    return true;
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Gets the memory used by the topology of the navigation mesh.
+         *
+         * Counts the walkability bitset, the region lookup tables and the component labels, but neither regions nor 
+         * any precomputed data.
+         *
+         * @return size_t The memory in bytes.
+         */
+        size_t getTopologyMemoryUsage() const
+        {
+            return m_walkability.getMemoryUsage() + (m_regionColumns.size() + m_regionRows.size()) * sizeof(ui32) + m_componentIDs.size() * sizeof(ui32) +
+                m_componentParents.size() * (sizeof(ui32) + sizeof(uint8_t));
+        }
+
+    private:
+        /**
+         * @brief Creates Region objects and assigns nodes to each region.
+         *
+         * Used for geometric preprocessing.
+         * It divides the NavMesh into rectangular regions. The region of a node is the sum of the entries of its 
+         * column and its row in two lookup tables, thus only the columns and rows are visited, not the nodes.
+         *
+         * @param regionLengthOnX The amount of regions on the `x` axis.
+         * @param regionLengthOnY The amount of regions on the `y` axis.
+         */
+        void createRegions(f32 regionLengthOnX, f32 regionLengthOnY)
+        {
+            ui32 numRegionsX = std::ceil(static_cast<f32>(m_width) / regionLengthOnX);
+            ui32 numRegionsY = std::ceil(static_cast<f32>(m_height) / regionLengthOnY);
+
+            m_regions = new RegionList(numRegionsX, numRegionsY);
+            m_regionLengthOnX = regionLengthOnX;
+            m_regionLengthOnY = regionLengthOnY;
+            m_regionColumns.resize(m_width);
+            m_regionRows.resize(m_height);
+
+            for (ui32 x = 0; x < m_width; x++)
+            {
+                ui32 xIndex = std::floor(static_cast<f32>(x) / regionLengthOnX);
+                m_regionColumns[x] = xIndex;
+
+                for (ui32 yIndex = 0; yIndex < numRegionsY; yIndex++)
+                {
+                    Region* region = m_regions->regions[m_regions->getRegionID(Vec2ui(xIndex, yIndex))];
+                    if (x == 0 || m_regionColumns[x - 1] != xIndex)
+                        region->minPos.x = x;
+                    region->maxPos.x = x;
+                }
+            }
+
+            for (ui32 y = 0; y < m_height; y++)
+            {
+                ui32 yIndex = std::floor(static_cast<f32>(y) / regionLengthOnY);
+                m_regionRows[y] = yIndex * numRegionsX;
+
+                for (ui32 xIndex = 0; xIndex < numRegionsX; xIndex++)
+                {
+                    Region* region = m_regions->regions[m_regions->getRegionID(Vec2ui(xIndex, yIndex))];
+                    if (y == 0 || m_regionRows[y - 1] != yIndex * numRegionsX)
+                        region->minPos.y = y;
+                    region->maxPos.y = y;
+                }
+            }
+        }
+
+        /**
+         * @brief Loads the navigation mesh from a memory-mapped binary file written by `saveToBinaryFile()`.
+         *
+         * The walkability bitset is copied from the file as a whole and the regions are created from the region 
+         * lengths of the header, thus no node is visited. The connected components are labeled lazily by 
+         * `ensureComponents()`.
+         *
+         * @param file The mapped file.
+         * @param filepath The relative path of the file, used for error messages.
+         */
+        void loadBinaryFile(const MappedFile& file, const std::string& filepath)
+        {
+            NavMeshFileHeader header;
+            if (file.getSize() < sizeof(NavMeshFileHeader))
+            {
+                std::cout << "Invalid NavMesh file " << filepath << std::endl;
+                return;
+            }
+            std::memcpy(&header, file.getData(), sizeof(header));
+
+            if (header.byteOrder != FILE_BYTE_ORDER_MARK)
+            {
+                std::cout << "NavMesh file " << filepath << " was written on a machine with a different byte order" << std::endl;
+                return;
+            }
+
+            if (header.version != NAVMESH_FILE_VERSION)
+            {
+                std::cout << "Unsupported NavMesh file version " << header.version << " in " << filepath << std::endl;
+                return;
+            }
+
+            uint64_t walkabilitySize = WalkabilityGrid::getNumWords(header.width, header.height) * sizeof(uint64_t);
+
+            if (!(header.regionLengthOnX >= 1.0f) || !(header.regionLengthOnY >= 1.0f) || 
+                header.walkabilityOffset % sizeof(uint64_t) != 0 || header.walkabilitySize != walkabilitySize ||
+                header.walkabilityOffset + walkabilitySize > file.getSize())
+            {
+                std::cout << "Invalid NavMesh file " << filepath << std::endl;
+                return;
+            }
+
+            initGrid(header.width, header.height);
+            m_walkability = WalkabilityGrid(header.width, header.height, reinterpret_cast<const uint64_t*>(file.getData() + header.walkabilityOffset));
+            createRegions(header.regionLengthOnX, header.regionLengthOnY);
+        }
+
+        /**
+         * @brief Sets the size of the navigation mesh and resets all nodes to `obstructable`.
+         *
+         * Done before generating or loading a NavMesh. Neighbors are not stored, but derived from the walkability 
+         * bitset whenever a node is expanded (`getNeighborMask()`).
+         *
+         * @param width The width of the navigation mesh.
+         * @param height The height of the navigation mesh.
+         */
+        void initGrid(ui32 width, ui32 height)
+        {
+            m_width = width;
+            m_height = height;
+            m_walkability = WalkabilityGrid(width, height);
+
+            for (ui32 direction = 0; direction < 8; direction++)
+            {
+                m_directionOffsets[direction] = GRID_DIRECTIONS[direction][0] + GRID_DIRECTIONS[direction][1] * static_cast<i32>(width);
+            }
+        }
+
+        /**
+         * @brief Checks whether a node is walkable.
+         *
+         * @param nodeIndex The index of the node within the NavMesh.
+         * @return `true` if the node is walkable, `false` otherwise.
+         */
+        bool isWalkable(ui32 nodeIndex) const
+        {
+            return m_walkability.isWalkable(nodeIndex % m_width, nodeIndex / m_width);
+        }
+
+        /**
+         * @brief Gets the ID of the region a node is assigned to.
+         *
+         * @param nodeIndex The index of the node within the NavMesh.
+         * @return ui32 The ID of the region.
+         */
+        ui32 getRegionID(ui32 nodeIndex) const
+        {
+            return m_regionColumns[nodeIndex % m_width] + m_regionRows[nodeIndex / m_width];
+        }
+
+        /**
+         * @brief Labels every walkable node with its connected component from scratch.
+         *
+         * Done once the NavMesh has been generated or loaded (see `ensureComponents()`), and whenever too many labels 
+         * have been used up by incremental updates.
+         */
+        void buildComponents()
+        {
+            m_componentIDs.assign(getNumNodes(), INVALID_INDEX);
+            m_componentParents.clear();
+            m_componentRanks.clear();
+
+            std::vector<ui32> stack;
+            for (ui32 y = 0; y < m_height; y++)
+            {
+                for (ui32 x = 0; x < m_width; x++)
+                {
+                    ui32 nodeIndex = x + y * m_width;
+                    if (!m_walkability.isWalkable(x, y) || m_componentIDs[nodeIndex] != INVALID_INDEX)
+                        continue;
+
+                    ui32 componentID = createComponent();
+                    m_componentIDs[nodeIndex] = componentID;
+                    stack.push_back(nodeIndex);
+
+                    while (!stack.empty())
+                    {
+                        ui32 currentIndex = stack.back();
+                        stack.pop_back();
+
+                        for (uint8_t mask = getNeighborMask(get2DCoordinates(currentIndex)); mask != 0; mask &= mask - 1)
+                        {
+                            ui32 neighborIndex = currentIndex + m_directionOffsets[std::countr_zero(mask)];
+                            if (m_componentIDs[neighborIndex] == INVALID_INDEX)
+                            {
+                                m_componentIDs[neighborIndex] = componentID;
+                                stack.push_back(neighborIndex);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Labels the connected components if this has not been done yet.
+         *
+         * Generated and text NavMeshes label them while being constructed, but binary files skip this to load 
+         * without visiting the nodes. Their labels are built by the first query that needs them instead. Concurrent 
+         * queries wait for that query to finish labeling.
+         */
+        void ensureComponents() const
+        {
+            std::call_once(m_componentsFlag, [this]() {
+                if (m_componentIDs.size() != getNumNodes())
+                    const_cast<NavMesh*>(this)->buildComponents();
+            });
+        }
+
+        /**
+         * @brief Creates a new label for a connected component.
+         *
+         * @return ui32 The new label.
+         */
+        ui32 createComponent()
+        {
+            m_componentParents.push_back(static_cast<ui32>(m_componentParents.size()));
+            m_componentRanks.push_back(0);
+            return m_componentParents.back();
+        }
+
+        /**
+         * @brief Gets the connected component of a node.
+         *
+         * Labels that were merged form a union-find forest, united by rank, thus the root is at most a logarithmic
+         * number of steps away. The paths are not compressed, such that searches on several threads can read the
+         * labels at once.
+         *
+         * @param nodeIndex The index of the node within the NavMesh.
+         * @return ui32 The root label of the component, or `INVALID_INDEX` if the node is obstructable.
+         */
+        ui32 getComponentID(ui32 nodeIndex) const
+        {
+            ui32 componentID = m_componentIDs[nodeIndex];
+            if (componentID == INVALID_INDEX)
+                return INVALID_INDEX;
+
+            while (m_componentParents[componentID] != componentID)
+            {
+                componentID = m_componentParents[componentID];
+            }
+
+            return componentID;
+        }
+
+        /**
+         * @brief Merges two connected components.
+         *
+         * @param a The root label of the first component.
+         * @param b The root label of the second component.
+         * @return ui32 The root label of the merged component.
+         */
+        ui32 uniteComponents(ui32 a, ui32 b)
+        {
+            if (a == b)
+                return a;
+
+            if (m_componentRanks[a] < m_componentRanks[b])
+                std::swap(a, b);
+
+            m_componentParents[b] = a;
+            if (m_componentRanks[a] == m_componentRanks[b])
+                m_componentRanks[a]++;
+
+            return a;
+        }
+
+        /**
+         * @brief Updates the connected components after a node has changed its state.
+         *
+         * A node that became walkable joins and merges the components of its walkable neighbors. \n
+         * A node that became obstructable may split its component. Its walkable neighbors are grouped by whether they
+         * are still adjacent to each other around the node; if there is only one group, nothing changes. Otherwise, a
+         * flood fill is started from each group, and the fills advance in turns, one node at a time. Fills that meet
+         * belong to the same component, while a group whose fills run out of nodes first has been cut off and gets a
+         * new label. Thus the work is bounded by the size of the smaller parts, which is small for most edits.
+         *
+         * @param nodeIndex The index of the changed node.
+         */
+        void updateComponents(ui32 nodeIndex)
+        {
+            ensureComponents();
+            if (m_componentParents.size() >= 2 * static_cast<size_t>(getNumNodes()))
+            {
+                buildComponents();
+                return;
+            }
+
+            Vec2ui pos = get2DCoordinates(nodeIndex);
+            uint8_t neighborMask = getNeighborMask(pos);
+
+            if (m_walkability.isWalkable(pos.x, pos.y))
+            {
+                ui32 componentID = INVALID_INDEX;
+                for (uint8_t mask = neighborMask; mask != 0; mask &= mask - 1)
+                {
+                    ui32 neighborComponentID = getComponentID(nodeIndex + m_directionOffsets[std::countr_zero(mask)]);
+                    componentID = componentID == INVALID_INDEX ? neighborComponentID : uniteComponents(componentID, neighborComponentID);
+                }
+
+                m_componentIDs[nodeIndex] = componentID == INVALID_INDEX ? createComponent() : componentID;
+                return;
+            }
+
+            m_componentIDs[nodeIndex] = INVALID_INDEX;
+
+            // Two neighbors of a node are adjacent to each other if their offsets differ by at most 1 on both axes
+            auto getAdjacentNeighbors = [neighborMask](ui32 direction) {
+                uint8_t adjacent = 0;
+                for (ui32 other = 0; other < 8; other++)
+                {
+                    if (std::abs(GRID_DIRECTIONS[direction][0] - GRID_DIRECTIONS[other][0]) <= 1 &&
+                        std::abs(GRID_DIRECTIONS[direction][1] - GRID_DIRECTIONS[other][1]) <= 1)
+                        adjacent |= 1 << other;
+                }
+                return static_cast<uint8_t>(adjacent & neighborMask);
+            };
+
+            ui32 numFills = 0;
+            std::vector<ui32> fills[4];
+            for (uint8_t remaining = neighborMask; remaining != 0; numFills++)
+            {
+                uint8_t group = remaining & -remaining;
+                for (uint8_t grown = 0; grown != group;)
+                {
+                    grown = group;
+                    for (uint8_t mask = grown; mask != 0; mask &= mask - 1)
+                    {
+                        group |= getAdjacentNeighbors(std::countr_zero(mask));
+                    }
+                }
+
+                fills[numFills].push_back(nodeIndex + m_directionOffsets[std::countr_zero(group)]);
+                remaining &= ~group;
+            }
+
+            if (numFills <= 1)
+                return;
+
+            // Each visited node is marked with the generation of the update and the fill that visited it
+            if (m_componentFillMarks.size() != getNumNodes() || m_componentFillGeneration == 0x3FFFFFFF)
+            {
+                m_componentFillMarks.assign(getNumNodes(), 0);
+                m_componentFillGeneration = 0;
+            }
+            m_componentFillGeneration++;
+
+            ui32 fillParents[4] = { 0, 1, 2, 3 };
+            ui32 heads[4] = {};
+            bool isCutOff[4] = {};
+            ui32 numGroups = numFills;
+
+            auto findFill = [&fillParents](ui32 fill) {
+                while (fillParents[fill] != fill)
+                {
+                    fill = fillParents[fill];
+                }
+                return fill;
+            };
+
+            for (ui32 fill = 0; fill < numFills; fill++)
+            {
+                m_componentFillMarks[fills[fill][0]] = m_componentFillGeneration << 2 | fill;
+            }
+
+            while (numGroups > 1)
+            {
+                for (ui32 fill = 0; fill < numFills; fill++)
+                {
+                    if (heads[fill] == fills[fill].size() || isCutOff[findFill(fill)])
+                        continue;
+
+                    ui32 currentIndex = fills[fill][heads[fill]++];
+                    for (uint8_t mask = getNeighborMask(get2DCoordinates(currentIndex)); mask != 0; mask &= mask - 1)
+                    {
+                        ui32 neighborIndex = currentIndex + m_directionOffsets[std::countr_zero(mask)];
+                        ui32 mark = m_componentFillMarks[neighborIndex];
+
+                        if (mark >> 2 != m_componentFillGeneration)
+                        {
+                            m_componentFillMarks[neighborIndex] = m_componentFillGeneration << 2 | fill;
+                            fills[fill].push_back(neighborIndex);
+                        }
+                        else if (findFill(mark & 3) != findFill(fill))
+                        {
+                            fillParents[findFill(mark & 3)] = findFill(fill);
+                            numGroups--;
+                        }
+                    }
+                }
+
+                // A group whose fills have all run out of nodes is not connected to the other groups
+                for (ui32 group = 0; group < numFills && numGroups > 1; group++)
+                {
+                    if (findFill(group) != group || isCutOff[group])
+                        continue;
+
+                    bool isExhausted = true;
+                    for (ui32 fill = 0; fill < numFills; fill++)
+                    {
+                        if (findFill(fill) == group && heads[fill] < fills[fill].size())
+                            isExhausted = false;
+                    }
+
+                    if (!isExhausted)
+                        continue;
+
+                    ui32 componentID = createComponent();
+                    for (ui32 fill = 0; fill < numFills; fill++)
+                    {
+                        if (findFill(fill) != group)
+                            continue;
+
+                        for (ui32 visitedIndex : fills[fill])
+                        {
+                            m_componentIDs[visitedIndex] = componentID;
+                        }
+                    }
+
+                    isCutOff[group] = true;
+                    numGroups--;
+                }
+            }
+        }
+
+        /**
+         * @brief Calculates the Manhattan distance between two Vec2ui objects.
+         *
+         * @param v1 First Vec2ui object.
+         * @param v2 Second Vec2ui object.
+         * @return f32 The Manhattan distance between the Vec2ui objects.
+         */
+        f32 manhattan(const Vec2ui& v1, const Vec2ui& v2)
+        {
+            f32 distX = std::abs(static_cast<f32>(v1.x) - static_cast<f32>(v2.x));
+            f32 distY = std::abs(static_cast<f32>(v1.y) - static_cast<f32>(v2.y));
+
+            return distX + distY;
+        }
+
+        /**
+         * @brief Calculates the Euclidean distance between two Vec2ui objects.
+         *
+         * @param v1 First Vec2ui object.
+         * @param v2 Second Vec2ui object.
+         * @return f32 The Euclidean distance between the Vec2ui objects.
+         */
+        f32 euclidean(const Vec2ui& v1, const Vec2ui& v2)
+        {
+            f32 distX = static_cast<f32>(v1.x) - static_cast<f32>(v2.x);
+            f32 distY = static_cast<f32>(v1.y) - static_cast<f32>(v2.y);
+            f32 dist = std::pow(distX, 2) + std::pow(distY, 2);
+
+            return std::sqrt(dist);
+        }
+
+        /**
+         * @brief Runs the one-to-all search of geometric preprocessing for one region.
+         *
+         * Dijkstra's algorithm is started from all walkable nodes of the region at once. Afterwards, the parent of 
+         * each reached node is the next node on its shortest path to the region, and its direction is stored in the 
+         * region's part of `m_nextHops`.
+         *
+         * @param region The region to search from.
+         * @param context The scratch memory used by the search.
+         * @param nextHops The table to write the directions of all nodes to.
+         */
+        void preprocessRegion(const Region* region, PathSearchContext& context, uint8_t* nextHops)
+        {
+            std::vector<ui32> sources;
+            for (ui32 y = region->minPos.y; y <= region->maxPos.y; y++)
+            {
+                for (ui32 x = region->minPos.x; x <= region->maxPos.x; x++)
+                {
+                    if (m_walkability.isWalkable(x, y))
+                        sources.push_back(getIndex(Vec2ui(x, y)));
+                }
+            }
+
+            dijkstra(sources, context);
+
+            for (ui32 i = 0; i < getNumNodes(); i++)
+            {
+                ui32 parent = context.getParent(i);
+                nextHops[i] = parent == INVALID_INDEX ? NO_DIRECTION : getDirection(get2DCoordinates(i), get2DCoordinates(parent));
+            }
+        }
+
+        /**
+         * @brief Updates all precomputed data after the state of a node has changed.
+         *
+         * The preprocessed directions of each region form a shortest path tree towards it, which is repaired entry by 
+         * entry instead of being searched again:
+         *  - A node that became obstructable only affects the nodes whose directions lead through it 
+         *    (`repairObstructableNode()`).
+         *  - A node that became walkable only affects the nodes to which it offers a shorter way 
+         *    (`repairWalkableNode()`).
+         *
+         * For most regions, neither set contains more than the changed node itself. Only if a repair would change 
+         * too many nodes (see `REPAIR_LIMIT_FRACTION`), the region is marked as dirty instead and rebuilt by 
+         * `updatePreprocessing()` or the background thread.
+         *
+         * Also increments the grid epoch, which invalidates all results cached for the previous state.
+         *
+         * @param nodeIndex The index of the changed node.
+         */
+        void onNodeChanged(ui32 nodeIndex)
+        {
+            m_gridEpoch++;
+
+            // New obstacles only make paths longer, thus only a new walkable node can break the landmark bounds
+            if (isWalkable(nodeIndex))
+                m_areLandmarksValid = false;
+
+            if (!m_isPreprocessed)
+                return;
+
+            bool isNodeWalkable = isWalkable(nodeIndex);
+            ui32 repairLimit = std::max(getNumNodes() / REPAIR_LIMIT_FRACTION, 1u);
+
+            std::lock_guard<std::mutex> lock(m_updateMutex);
+
+            for (ui32 regionID = 0; regionID < m_regions->regions.size(); regionID++)
+            {
+                m_regionEditCounts[regionID]++;
+                if (m_dirtyRegions[regionID].load(std::memory_order_relaxed))
+                    continue;
+
+                bool isRepaired = isNodeWalkable ? repairWalkableNode(regionID, nodeIndex, repairLimit) : 
+                    repairObstructableNode(regionID, nodeIndex, repairLimit);
+
+                if (!isRepaired)
+                {
+                    m_dirtyRegions[regionID].store(true, std::memory_order_release);
+                    m_updateQueue.push_back(regionID);
+                }
+            }
+
+            m_updateWake.notify_one();
+        }
+
+        /**
+         * @brief Repairs the preprocessed directions of a region after a node has become obstructable.
+         *
+         * The nodes whose directions lead through the changed node form a subtree below it, which is collected by 
+         * following the directions backwards. All other nodes keep their paths. Dijkstra's algorithm is then run on 
+         * the subtree only, seeded with the costs of the nodes bordering it.
+         *
+         * @param regionID The ID of the region.
+         * @param nodeIndex The index of the changed node.
+         * @param repairLimit The maximum size of the subtree.
+         * @return `true` if the directions have been repaired, `false` if the subtree is too large.
+         */
+        bool repairObstructableNode(ui32 regionID, ui32 nodeIndex, ui32 repairLimit)
+        {
+            uint8_t* nextHops = getNextHops(regionID);
+            nextHops[nodeIndex] = NO_DIRECTION;
+
+            // The nodes of the subtree are closed in the context; the opposite of direction d is 7 - d
+            PathSearchContext& context = m_searchContext;
+            context.beginQuery(getNumNodes());
+            context.close(nodeIndex);
+
+            std::vector<ui32>& subtree = m_repairNodes;
+            subtree.assign(1, nodeIndex);
+
+            for (size_t i = 0; i < subtree.size(); i++)
+            {
+                for (uint8_t mask = getNeighborMask(get2DCoordinates(subtree[i])); mask != 0; mask &= mask - 1)
+                {
+                    ui32 direction = std::countr_zero(mask);
+                    ui32 neighborIndex = subtree[i] + m_directionOffsets[direction];
+                    if (nextHops[neighborIndex] == 7 - direction && !context.isClosed(neighborIndex))
+                    {
+                        if (subtree.size() > repairLimit)
+                            return false;
+
+                        context.close(neighborIndex);
+                        subtree.push_back(neighborIndex);
+                    }
+                }
+            }
+
+            if (subtree.size() == 1)
+                return true;
+
+            beginRepair();
+            IndexedHeap& openSet = context.getOpenSet();
+
+            for (size_t i = 1; i < subtree.size(); i++)
+            {
+                for (uint8_t mask = getNeighborMask(get2DCoordinates(subtree[i])); mask != 0; mask &= mask - 1)
+                {
+                    ui32 direction = std::countr_zero(mask);
+                    ui32 neighborIndex = subtree[i] + m_directionOffsets[direction];
+                    if (context.isClosed(neighborIndex))
+                        continue;
+
+                    f32 cost = getCostToRegion(regionID, neighborIndex) + GRID_DIRECTION_COSTS[direction];
+                    if (cost < context.getG(subtree[i]))
+                    {
+                        context.setVisited(subtree[i], cost, neighborIndex);
+                        openSet.push(subtree[i], cost);
+                    }
+                }
+            }
+
+            while (!openSet.empty())
+            {
+                ui32 currentIndex = openSet.pop();
+                f32 currentG = context.getG(currentIndex);
+
+                for (uint8_t mask = getNeighborMask(get2DCoordinates(currentIndex)); mask != 0; mask &= mask - 1)
+                {
+                    ui32 direction = std::countr_zero(mask);
+                    ui32 neighborIndex = currentIndex + m_directionOffsets[direction];
+                    f32 tentativeG = currentG + GRID_DIRECTION_COSTS[direction];
+
+                    if (context.isClosed(neighborIndex) && tentativeG < context.getG(neighborIndex))
+                    {
+                        context.setVisited(neighborIndex, tentativeG, currentIndex);
+                        openSet.push(neighborIndex, tentativeG);
+                    }
+                }
+            }
+
+            for (size_t i = 1; i < subtree.size(); i++)
+            {
+                ui32 parent = context.getParent(subtree[i]);
+                nextHops[subtree[i]] = parent == INVALID_INDEX ? NO_DIRECTION : getDirection(get2DCoordinates(subtree[i]), get2DCoordinates(parent));
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Repairs the preprocessed directions of a region after a node has become walkable.
+         *
+         * The changed node takes the cheapest path through one of its neighbors. From there, a Dijkstra search only 
+         * visits the nodes whose stored paths it can shorten, and redirects them.
+         *
+         * @param regionID The ID of the region.
+         * @param nodeIndex The index of the changed node.
+         * @param repairLimit The maximum number of redirected nodes.
+         * @return `true` if the directions have been repaired, `false` if too many nodes would be redirected.
+         */
+        bool repairWalkableNode(ui32 regionID, ui32 nodeIndex, ui32 repairLimit)
+        {
+            uint8_t* nextHops = getNextHops(regionID);
+
+            beginRepair();
+            m_repairCosts[nodeIndex] = INFINITY;
+            m_repairMarks[nodeIndex] = m_repairGeneration;
+
+            // Find the cost of the changed node through its best neighbor
+            f32 cost = 0.0f;
+            uint8_t bestDirection = NO_DIRECTION;
+
+            if (getRegionID(nodeIndex) != regionID)
+            {
+                cost = INFINITY;
+                for (uint8_t mask = getNeighborMask(get2DCoordinates(nodeIndex)); mask != 0; mask &= mask - 1)
+                {
+                    ui32 direction = std::countr_zero(mask);
+                    f32 neighborCost = getCostToRegion(regionID, nodeIndex + m_directionOffsets[direction]) + GRID_DIRECTION_COSTS[direction];
+                    if (neighborCost < cost)
+                    {
+                        cost = neighborCost;
+                        bestDirection = static_cast<uint8_t>(direction);
+                    }
+                }
+            }
+
+            nextHops[nodeIndex] = bestDirection;
+            if (cost == INFINITY)
+                return true;
+
+            PathSearchContext& context = m_searchContext;
+            context.beginQuery(getNumNodes());
+            IndexedHeap& openSet = context.getOpenSet();
+            context.setVisited(nodeIndex, cost, INVALID_INDEX);
+            openSet.push(nodeIndex, cost);
+
+            ui32 numRedirected = 0;
+            while (!openSet.empty())
+            {
+                if (++numRedirected > repairLimit)
+                    return false;
+
+                ui32 currentIndex = openSet.pop();
+                f32 currentG = context.getG(currentIndex);
+
+                for (uint8_t mask = getNeighborMask(get2DCoordinates(currentIndex)); mask != 0; mask &= mask - 1)
+                {
+                    ui32 direction = std::countr_zero(mask);
+                    ui32 neighborIndex = currentIndex + m_directionOffsets[direction];
+                    f32 tentativeG = currentG + GRID_DIRECTION_COSTS[direction];
+
+                    // Compared with the stored cost before the neighbor is redirected, which memoizes it
+                    if (getRegionID(neighborIndex) == regionID || tentativeG + 1e-4f >= getCostToRegion(regionID, neighborIndex) || 
+                        tentativeG >= context.getG(neighborIndex))
+                        continue;
+
+                    context.setVisited(neighborIndex, tentativeG, currentIndex);
+                    openSet.push(neighborIndex, tentativeG);
+                    nextHops[neighborIndex] = static_cast<uint8_t>(7 - direction);
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Starts a new repair of the preprocessed directions, forgetting all costs memoized by 
+         * `getCostToRegion()`.
+         *
+         */
+        void beginRepair()
+        {
+            if (m_repairMarks.size() != getNumNodes() || m_repairGeneration == INVALID_INDEX)
+            {
+                m_repairMarks.assign(getNumNodes(), 0);
+                m_repairCosts.resize(getNumNodes());
+                m_repairGeneration = 0;
+            }
+            m_repairGeneration++;
+        }
+
+        /**
+         * @brief Gets the cost of the stored path from a node to a region by following the preprocessed directions.
+         *
+         * The costs of all nodes on the way are memoized until the next `beginRepair()`, thus every node is followed 
+         * at most once per repair, and a memoized cost stays the one from before the repair redirected the node.
+         *
+         * @param regionID The ID of the region.
+         * @param nodeIndex The index of the node.
+         * @return f32 The cost of the path, or `INFINITY` if the node cannot reach the region.
+         */
+        f32 getCostToRegion(ui32 regionID, ui32 nodeIndex)
+        {
+            const uint8_t* nextHops = getNextHops(regionID);
+            std::vector<ui32>& chain = m_repairChain;
+            chain.clear();
+
+            f32 cost = INFINITY;
+            while (m_repairMarks[nodeIndex] != m_repairGeneration)
+            {
+                uint8_t direction = nextHops[nodeIndex];
+                if (!isWalkable(nodeIndex) || getRegionID(nodeIndex) == regionID || direction == NO_DIRECTION)
+                {
+                    cost = isWalkable(nodeIndex) && getRegionID(nodeIndex) == regionID ? 0.0f : INFINITY;
+                    m_repairCosts[nodeIndex] = cost;
+                    m_repairMarks[nodeIndex] = m_repairGeneration;
+                    break;
+                }
+
+                chain.push_back(nodeIndex);
+                nodeIndex += m_directionOffsets[direction];
+            }
+
+            cost = m_repairCosts[nodeIndex];
+            for (auto it = chain.rbegin(); it != chain.rend(); it++)
+            {
+                cost += GRID_DIRECTION_COSTS[nextHops[*it]];
+                m_repairCosts[*it] = cost;
+                m_repairMarks[*it] = m_repairGeneration;
+            }
+
+            return cost;
+        }
+
+        /**
+         * @brief The loop run by the background update thread.
+         *
+         * Takes invalidated regions from `m_updateQueue` and rebuilds them into a separate buffer while holding a 
+         * shared lock on the node states. The result is only swapped in if the region has not been edited again in 
+         * the meantime; otherwise the region is queued again.
+         */
+        void updateLoop()
+        {
+            PathSearchContext context;
+            std::vector<uint8_t> buffer(getNumNodes());
+
+            while (true)
+            {
+                ui32 regionID;
+                ui32 editCount;
+                {
+                    std::unique_lock<std::mutex> lock(m_updateMutex);
+                    m_updateWake.wait(lock, [this]() { return m_stopUpdates || !m_updateQueue.empty(); });
+
+                    if (m_stopUpdates)
+                        return;
+
+                    regionID = m_updateQueue.front();
+                    m_updateQueue.pop_front();
+                    editCount = m_regionEditCounts[regionID];
+                    m_isUpdating = true;
+                }
+
+                {
+                    std::shared_lock<std::shared_mutex> stateLock(m_stateMutex);
+                    preprocessRegion(m_regions->regions[regionID], context, buffer.data());
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(m_updateMutex);
+
+                    if (editCount == m_regionEditCounts[regionID])
+                    {
+                        std::copy(buffer.begin(), buffer.end(), getNextHops(regionID));
+                        m_dirtyRegions[regionID].store(false, std::memory_order_release);
+                    }
+                    else
+                    {
+                        m_updateQueue.push_back(regionID);
+                    }
+
+                    m_isUpdating = false;
+                }
+                m_updateDone.notify_all();
+            }
+        }
+
+        /**
+         * @brief Gets the ThreadPool of the NavMesh, creating it if it has fewer than the requested worker threads.
+         *
+         * The pool is kept when fewer threads are requested, thus callers pass `numThreads` to 
+         * `ThreadPool::parallelFor()` as well. Also makes sure that there is one PathSearchContext per worker in 
+         * `m_workerContexts`.
+         *
+         * @param numThreads The number of worker threads.
+         * @return ThreadPool& The thread pool.
+         */
+        ThreadPool& getThreadPool(ui32 numThreads)
+        {
+            numThreads = std::max(numThreads, 1u);
+
+            if (!m_threadPool || m_threadPool->getNumThreads() < numThreads)
+            {
+                m_threadPool = std::make_unique<ThreadPool>(numThreads);
+                m_workerContexts.resize(numThreads);
+            }
+
+            return *m_threadPool;
+        }
+
+        /**
+         * @brief Looks up the path between two nodes in the path cache.
+         *
+         * Paths found at an older grid epoch are removed instead of returned.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param path Receives the cached path.
+         * @return `true` if a valid path was cached, `false` otherwise.
+         */
+        bool getCachedPath(const Vec2ui& start, const Vec2ui& target, std::vector<Vec2ui>& path)
+        {
+            uint64_t key = static_cast<uint64_t>(getIndex(start)) << 32 | getIndex(target);
+
+            std::lock_guard<std::mutex> lock(m_pathCacheMutex);
+
+            auto it = m_pathCacheIndex.find(key);
+            if (it == m_pathCacheIndex.end())
+            {
+                m_pathCacheStats.misses++;
+                return false;
+            }
+
+            if (it->second->epoch != m_gridEpoch.load())
+            {
+                m_pathCacheEntries.erase(it->second);
+                m_pathCacheIndex.erase(it);
+                m_pathCacheStats.invalidations++;
+                m_pathCacheStats.misses++;
+                return false;
+            }
+
+            // Move the entry to the front, which holds the most recently used paths
+            m_pathCacheEntries.splice(m_pathCacheEntries.begin(), m_pathCacheEntries, it->second);
+            path = it->second->path;
+            m_pathCacheStats.hits++;
+
+            return true;
+        }
+
+        /**
+         * @brief Stores the path between two nodes in the path cache.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param path The path to store.
+         * @param epoch The grid epoch at which the search started.
+         */
+        void cachePath(const Vec2ui& start, const Vec2ui& target, const std::vector<Vec2ui>& path, uint64_t epoch)
+        {
+            uint64_t key = static_cast<uint64_t>(getIndex(start)) << 32 | getIndex(target);
+
+            std::lock_guard<std::mutex> lock(m_pathCacheMutex);
+
+            if (m_pathCacheCapacity == 0 || m_pathCacheIndex.count(key) != 0)
+                return;
+
+            if (m_pathCacheEntries.size() >= m_pathCacheCapacity)
+            {
+                m_pathCacheIndex.erase(m_pathCacheEntries.back().key);
+                m_pathCacheEntries.pop_back();
+                m_pathCacheStats.evictions++;
+            }
+
+            m_pathCacheEntries.push_front({ key, epoch, path });
+            m_pathCacheIndex[key] = m_pathCacheEntries.begin();
+        }
+
+        /**
+         * @brief Discards all pending incremental updates, e.g. because the preprocessing is replaced as a whole.
+         *
+         * Waits until the background thread has finished its current region.
+         */
+        void resetUpdates()
+        {
+            ui32 numRegions = static_cast<ui32>(m_regions->regions.size());
+
+            std::unique_lock<std::mutex> lock(m_updateMutex);
+            m_updateQueue.clear();
+            m_updateDone.wait(lock, [this]() { return !m_isUpdating; });
+
+            m_dirtyRegions = std::make_unique<std::atomic<bool>[]>(numRegions);
+            m_regionEditCounts.assign(numRegions, 0);
+        }
+
+        /**
+         * @brief Calculates a checksum of the size, node states and regions of the navigation mesh.
+         *
+         * Uses the 64-bit FNV-1a hash.
+         *
+         * @return uint64_t The checksum.
+         */
+        uint64_t computeGridChecksum() const
+        {
+            uint64_t checksum = 14695981039346656037ull;
+            auto add = [&checksum](ui32 value) {
+                for (ui32 i = 0; i < 4; i++)
+                {
+                    checksum ^= (value >> (i * 8)) & 0xFF;
+                    checksum *= 1099511628211ull;
+                }
+            };
+
+            add(m_width);
+            add(m_height);
+            for (ui32 y = 0; y < m_height; y++)
+            {
+                for (ui32 x = 0; x < m_width; x++)
+                {
+                    add(m_walkability.isWalkable(x, y) ? NodeState::WALKABLE : NodeState::OBSTRUCTABLE);
+                    add(getRegionID(Vec2ui(x, y)));
+                }
+            }
+
+            return checksum;
+        }
+
+        /**
+         * @brief Gets the part of the next-hop table that belongs to a region.
+         *
+         * @param regionID The ID of the region.
+         * @return uint8_t* The direction of each node towards the region.
+         */
+        uint8_t* getNextHops(ui32 regionID)
+        {
+            return m_nextHopData + static_cast<size_t>(regionID) * getNumNodes();
+        }
+
+        /**
+         * @brief Gets the direction of the next node on the shortest path from a node to a region.
+         *
+         * @param regionID The ID of the region.
+         * @param nodeIndex The index of the node.
+         * @return uint8_t The index within `GRID_DIRECTIONS`, or `NO_DIRECTION` if the node is part of the region or 
+         * cannot reach it.
+         */
+        uint8_t getNextHop(ui32 regionID, ui32 nodeIndex) const
+        {
+            return m_nextHopData[static_cast<size_t>(regionID) * getNumNodes() + nodeIndex];
+        }
+
+        /**
+         * @brief Picks the landmarks of `buildLandmarks()` around the largest connected component.
+         *
+         * @param numLandmarks The number of sectors; sectors without walkable nodes get no landmark.
+         * @return std::vector<Vec2ui> The positions of the landmarks.
+         */
+        std::vector<Vec2ui> selectLandmarks(ui32 numLandmarks) const
+        {
+            ensureComponents();
+            std::vector<ui32> componentSizes(m_componentParents.size(), 0);
+            for (ui32 i = 0; i < getNumNodes(); i++)
+            {
+                ui32 componentID = getComponentID(i);
+                if (componentID != INVALID_INDEX)
+                    componentSizes[componentID]++;
+            }
+
+            auto largestComponent = std::max_element(componentSizes.begin(), componentSizes.end());
+            if (largestComponent == componentSizes.end() || *largestComponent == 0 || numLandmarks == 0)
+                return {};
+
+            ui32 largestComponentID = static_cast<ui32>(largestComponent - componentSizes.begin());
+
+            f32 centerX = 0.0f, centerY = 0.0f;
+            for (ui32 i = 0; i < getNumNodes(); i++)
+            {
+                if (getComponentID(i) == largestComponentID)
+                {
+                    Vec2ui pos = get2DCoordinates(i);
+                    centerX += static_cast<f32>(pos.x) / componentSizes[largestComponentID];
+                    centerY += static_cast<f32>(pos.y) / componentSizes[largestComponentID];
+                }
+            }
+
+            std::vector<ui32> farthestNodes(numLandmarks, INVALID_INDEX);
+            std::vector<f32> farthestDistances(numLandmarks, -1.0f);
+
+            for (ui32 i = 0; i < getNumNodes(); i++)
+            {
+                if (getComponentID(i) != largestComponentID)
+                    continue;
+
+                Vec2ui pos = get2DCoordinates(i);
+                f32 x = static_cast<f32>(pos.x) - centerX;
+                f32 y = static_cast<f32>(pos.y) - centerY;
+                f32 angle = std::atan2(y, x) + PI;
+                ui32 sector = std::min(static_cast<ui32>(angle / (2.0f * PI) * numLandmarks), numLandmarks - 1);
+
+                f32 squaredDistance = x * x + y * y;
+                if (squaredDistance > farthestDistances[sector])
+                {
+                    farthestDistances[sector] = squaredDistance;
+                    farthestNodes[sector] = i;
+                }
+            }
+
+            std::vector<Vec2ui> landmarks;
+            for (ui32 nodeIndex : farthestNodes)
+            {
+                if (nodeIndex != INVALID_INDEX)
+                    landmarks.push_back(get2DCoordinates(nodeIndex));
+            }
+
+            return landmarks;
+        }
+
+        /**
+         * @brief Estimates the cost of the path between two nodes with a heuristic policy.
+         *
+         * Same as `estimateCost()`, except for `LandmarkHeuristic`, which also applies the landmark bounds.
+         *
+         * @tparam Heuristic The heuristic policy, e.g. `OctileHeuristic`.
+         * @param fromIndex The index of the first node.
+         * @param from The position of the first node.
+         * @param toIndex The index of the second node.
+         * @param to The position of the second node.
+         * @return f32 The estimated cost.
+         */
+        template <typename Heuristic>
+        f32 estimateNodeCost(ui32 fromIndex, const Vec2ui& from, ui32 toIndex, const Vec2ui& to) const
+        {
+            f32 estimate = estimateCost<Heuristic>(from, to);
+
+            if constexpr (std::is_same_v<Heuristic, LandmarkHeuristic>)
+            {
+                if (!m_areLandmarksValid.load(std::memory_order_relaxed))
+                    return estimate;
+
+                size_t numLandmarks = m_landmarks.size();
+                const f32* fromDistances = &m_landmarkDistances[fromIndex * numLandmarks];
+                const f32* toDistances = &m_landmarkDistances[toIndex * numLandmarks];
+
+                // All landmarks lie in the same component, thus a node is either reached by all of them or by none
+                if (fromDistances[0] == INFINITY || toDistances[0] == INFINITY)
+                    return estimate;
+
+                for (size_t landmark = 0; landmark < numLandmarks; landmark++)
+                {
+                    estimate = std::max(estimate, std::abs(fromDistances[landmark] - toDistances[landmark]));
+                }
+            }
+
+            return estimate;
+        }
+
+        /**
+         * @brief Dijkstra's algorithm. Computes the cost of the shortest path from a set of nodes to all other nodes.
+         *
+         * All source nodes start with a cost of 0. The costs and parents can be read from the context until the next 
+         * query starts.
+         *
+         * @param sources The indices of the nodes to start from.
+         * @param context The scratch memory used by the search.
+         * @param stopNodes If not empty, the search stops as soon as all of these nodes have been closed.
+         */
+        void dijkstra(const std::vector<ui32>& sources, PathSearchContext& context, std::vector<ui32> stopNodes = {})
+        {
+            context.beginQuery(getNumNodes());
+            IndexedHeap& openSet = context.getOpenSet();
+
+            for (ui32 source : sources)
+            {
+                context.setVisited(source, 0.0f, INVALID_INDEX);
+                openSet.push(source, 0.0f);
+            }
+
+            std::sort(stopNodes.begin(), stopNodes.end());
+            stopNodes.erase(std::unique(stopNodes.begin(), stopNodes.end()), stopNodes.end());
+            size_t remainingStopNodes = stopNodes.size();
+
+            while (!openSet.empty())
+            {
+                ui32 currentIndex = openSet.pop();
+                context.close(currentIndex);
+
+                if (remainingStopNodes > 0 && std::binary_search(stopNodes.begin(), stopNodes.end(), currentIndex) && --remainingStopNodes == 0)
+                    return;
+
+                Vec2ui currentPos = get2DCoordinates(currentIndex);
+                f32 currentG = context.getG(currentIndex);
+
+                for (uint8_t mask = getNeighborMask(currentPos); mask != 0; mask &= mask - 1)
+                {
+                    ui32 direction = std::countr_zero(mask);
+                    ui32 neighborIndex = currentIndex + m_directionOffsets[direction];
+                    if (context.isClosed(neighborIndex))
+                        continue;
+
+                    f32 tentativeG = currentG + GRID_DIRECTION_COSTS[direction];
+
+                    if (tentativeG < context.getG(neighborIndex))
+                    {
+                        context.setVisited(neighborIndex, tentativeG, currentIndex);
+                        openSet.push(neighborIndex, tentativeG);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Runs a path query and records its measurements if `PATH_STATS_ENABLED` is set.
+         *
+         * The counters of the context and of its reverse context are reset before the query and read afterwards, 
+         * thus they cover every search the query runs. The measurements are stored in the context and added to the 
+         * aggregates of the NavMesh. Queries slower than the threshold of `setSlowQueryCallback()` are reported to 
+         * the callback, outside of any lock. 
+         *
+         * Without `PATH_STATS_ENABLED`, only the query itself is compiled.
+         *
+         * @tparam Query The type of the query.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the query.
+         * @param path The path the query writes to.
+         * @param query Runs the query; receives whether it was answered from the path cache and returns whether a 
+         * path was found.
+         * @return `true` if a path was found, `false` otherwise.
+         */
+        template <typename Query>
+        bool instrumentQuery(Vec2ui start, Vec2ui target, PathSearchContext& context, const std::vector<Vec2ui>& path, Query&& query)
+        {
+            bool isCacheHit = false;
+
+            if constexpr (!PATH_STATS_ENABLED)
+            {
+                return query(isCacheHit);
+            }
+            else
+            {
+                PathSearchContext& reverseContext = context.getReverseContext();
+                for (PathSearchContext* searchContext : { &context, &reverseContext })
+                {
+                    searchContext->m_numCountedClosed = 0;
+                    searchContext->getOpenSet().resetCounters();
+                }
+
+                auto startTime = std::chrono::steady_clock::now();
+                bool isFound = query(isCacheHit);
+                auto endTime = std::chrono::steady_clock::now();
+
+                PathQueryStats& stats = context.m_queryStats;
+                stats = PathQueryStats();
+                stats.start = start;
+                stats.target = target;
+                stats.pathLength = isFound ? static_cast<ui32>(path.size()) : 0;
+                stats.duration = std::chrono::duration<f32, std::micro>(endTime - startTime).count();
+                stats.isCacheHit = isCacheHit;
+
+                for (PathSearchContext* searchContext : { &context, &reverseContext })
+                {
+                    const IndexedHeap& openSet = searchContext->getOpenSet();
+                    stats.numExpanded += searchContext->m_numCountedClosed;
+                    stats.numPushes += openSet.getNumPushes();
+                    stats.numPops += openSet.getNumPops();
+                    stats.maxOpenSetSize = std::max(stats.maxOpenSetSize, openSet.getMaxSize());
+                }
+
+                SlowQueryCallback callback;
+                {
+                    std::lock_guard<std::mutex> lock(m_pathStatsMutex);
+                    m_pathStats.record(stats);
+
+                    if (m_slowQueryCallback && stats.duration >= m_slowQueryThreshold)
+                        callback = m_slowQueryCallback;
+                }
+
+                if (callback)
+                    callback(stats);
+
+                return isFound;
+            }
+        }
+
+        /**
+         * @brief Finds the shortest path between two nodes, see `findPath()`, without recording any measurements.
+         *
+         * @tparam Heuristic The heuristic and cost policy of the search.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search.
+         * @param path Receives the shortest found path, or an empty list.
+         * @param mode The search algorithm to use.
+         * @param isCacheHit Set to `true` if the path was taken from the path cache.
+         * @return `true` if a path was found, `false` otherwise.
+         */
+        template <typename Heuristic>
+        bool searchPath(Vec2ui start, Vec2ui target, PathSearchContext& context, std::vector<Vec2ui>& path, PathSearchMode mode, bool& isCacheHit)
+        {
+            path.clear();
+            if (!isReachable(start, target))
+                return false;
+
+            bool isCacheEnabled = Heuristic::IS_OPTIMAL && m_pathCacheCapacity.load(std::memory_order_relaxed) > 0;
+
+            if (isCacheEnabled && getCachedPath(start, target, path))
+            {
+                isCacheHit = true;
+                return !path.empty();
+            }
+
+            uint64_t epoch = m_gridEpoch.load();
+
+            if (mode == PathSearchMode::JUMP_POINT_SEARCH)
+            {
+                jumpPointSearch<Heuristic>(start, target, context, path);
+            }
+            else if (mode == PathSearchMode::BIDIRECTIONAL_ASTAR)
+            {
+                bidirectionalAStar<Heuristic>(start, target, context, path);
+            }
+            else
+            {
+                AStar<Heuristic>(start, target, context, path);
+            }
+
+            if (isCacheEnabled)
+            {
+                cachePath(start, target, path, epoch);
+            }
+
+            return !path.empty();
+        }
+
+        /**
+         * @brief Finds the stored path between two nodes, see `findPreprocessedPath()`, without recording any 
+         * measurements.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search.
+         * @param path Receives the shortest found path, or an empty list.
+         * @param isCacheHit Set to `true` if a search within the target region was answered from the path cache.
+         * @return `true` if a path was found, `false` otherwise.
+         */
+        bool searchPreprocessedPath(Vec2ui start, Vec2ui target, PathSearchContext& context, std::vector<Vec2ui>& path, bool& isCacheHit)
+        {
+            path.clear();
+            if (!isReachable(start, target))
+                return false;
+
+            ui32 startRegionID = getRegionID(start);
+            ui32 targetRegionID = getRegionID(target);
+
+            // If start and target nodes are in the same region, call A* to find the shortest path.
+            if (startRegionID == targetRegionID)
+            {
+                return searchPath<OctileHeuristic>(start, target, context, path, PathSearchMode::ASTAR, isCacheHit);
+            }
+
+            if (!m_isPreprocessed)
+            {
+                std::cout << "Geometric preprocessing has not been performed!" << std::endl;
+                return false;
+            }
+
+            // The stored directions to this region are outdated until the region has been rebuilt.
+            if (m_dirtyRegions[targetRegionID].load(std::memory_order_acquire))
+            {
+                return searchPath<OctileHeuristic>(start, target, context, path, PathSearchMode::ASTAR, isCacheHit);
+            }
+
+            // Follow the stored directions from the start node to the region in which the target node is.
+            ui32 currentIndex = getIndex(start);
+            ui32 numSteps = 0;
+
+            while (getRegionID(currentIndex) != targetRegionID)
+            {
+                uint8_t direction = getNextHop(targetRegionID, currentIndex);
+                if (direction == NO_DIRECTION)
+                {
+                    std::cout << "No path found to target region!" << std::endl;
+                    return false;
+                }
+
+                currentIndex += m_directionOffsets[direction];
+                numSteps++;
+            }
+
+            // If the end node of the path is not the target, get the shortest path between it and the target.
+            Vec2ui pathEndNode = get2DCoordinates(currentIndex);
+            if (pathEndNode == target)
+            {
+                path.push_back(target);
+            }
+            else if (!searchPath<OctileHeuristic>(pathEndNode, target, context, path, PathSearchMode::ASTAR, isCacheHit))
+            {
+                std::cout << "No path found inside target region!" << std::endl;
+                return false;
+            }
+
+            // Put the nodes from the start node up to the end node in front: (start -> endNode) + (endNode -> target)
+            path.insert(path.begin(), numSteps, start);
+            currentIndex = getIndex(start);
+
+            for (ui32 i = 0; i < numSteps; i++)
+            {
+                path[i] = get2DCoordinates(currentIndex);
+                currentIndex += m_directionOffsets[getNextHop(targetRegionID, currentIndex)];
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Finds a path using the abstract graph, see `findHierarchicalPath()`, without recording any 
+         * measurements.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the searches.
+         * @param path Receives the found path, or an empty list.
+         * @param isCacheHit Set to `true` if the fallback to A* was answered from the path cache.
+         * @return `true` if a path was found, `false` otherwise.
+         */
+        bool searchHierarchicalPath(Vec2ui start, Vec2ui target, PathSearchContext& context, std::vector<Vec2ui>& path, bool& isCacheHit)
+        {
+            path.clear();
+            if (!m_isHierarchyBuilt)
+            {
+                std::cout << "The hierarchy has not been built!" << std::endl;
+                return false;
+            }
+
+            // The entrances and cached costs are outdated until the hierarchy has been rebuilt.
+            if (m_hierarchyEpoch != m_gridEpoch.load())
+            {
+                return searchPath<OctileHeuristic>(start, target, context, path, PathSearchMode::ASTAR, isCacheHit);
+            }
+
+            if (!areConnected(start, target))
+                return false;
+
+            ui32 startNodeIndex = getIndex(start);
+            ui32 targetNodeIndex = getIndex(target);
+
+            const Region* startRegion = m_regions->regions[getRegionID(startNodeIndex)];
+            const Region* targetRegion = m_regions->regions[getRegionID(targetNodeIndex)];
+
+            if (startRegion == targetRegion)
+            {
+                AStar(start, target, context, path, startRegion);
+                if (path.size() > 0)
+                    return true;
+            }
+
+            // Connect the start and target nodes to the abstract nodes of their regions
+            ui32 numAbstractNodes = static_cast<ui32>(m_hierarchyCells.size());
+            ui32 startID = numAbstractNodes;
+            ui32 targetID = numAbstractNodes + 1;
+
+            std::vector<HierarchyEdge> startEdges;
+            regionDijkstra(startNodeIndex, startRegion, context);
+            for (ui32 entrance : m_regionEntrances[startRegion->regionID])
+            {
+                f32 cost = context.getG(m_hierarchyCells[entrance]);
+                if (cost != INFINITY)
+                    startEdges.push_back(HierarchyEdge{ entrance, cost });
+            }
+
+            std::vector<HierarchyEdge> targetEdges;
+            regionDijkstra(targetNodeIndex, targetRegion, context);
+            for (ui32 entrance : m_regionEntrances[targetRegion->regionID])
+            {
+                f32 cost = context.getG(m_hierarchyCells[entrance]);
+                if (cost != INFINITY)
+                    targetEdges.push_back(HierarchyEdge{ entrance, cost });
+            }
+
+            auto getCell = [this, startID, targetID, startNodeIndex, targetNodeIndex](ui32 id) {
+                if (id == startID)
+                    return startNodeIndex;
+                if (id == targetID)
+                    return targetNodeIndex;
+                return m_hierarchyCells[id];
+            };
+
+            // A* on the abstract graph
+            context.beginQuery(numAbstractNodes + 2);
+            IndexedHeap& openSet = context.getOpenSet();
+
+            context.setVisited(startID, 0.0f, INVALID_INDEX);
+            openSet.push(startID, 0.0f);
+
+            std::vector<ui32> abstractPath;
+            while (!openSet.empty())
+            {
+                ui32 currentID = openSet.pop();
+                context.close(currentID);
+
+                if (currentID == targetID)
+                {
+                    abstractPath = context.reconstructPath(currentID);
+                    break;
+                }
+
+                f32 currentG = context.getG(currentID);
+                auto relax = [this, &context, &openSet, &getCell, currentID, currentG, target](ui32 neighborID, f32 cost) {
+                    if (context.isClosed(neighborID))
+                        return;
+
+                    f32 tentativeG = currentG + cost;
+                    if (tentativeG < context.getG(neighborID))
+                    {
+                        context.setVisited(neighborID, tentativeG, currentID);
+                        openSet.push(neighborID, tentativeG + estimateCost<OctileHeuristic>(get2DCoordinates(getCell(neighborID)), target));
+                    }
+                };
+
+                if (currentID == startID)
+                {
+                    for (const HierarchyEdge& edge : startEdges)
+                        relax(edge.target, edge.cost);
+                    continue;
+                }
+
+                for (const HierarchyEdge& edge : m_hierarchyEdges[currentID])
+                    relax(edge.target, edge.cost);
+
+                for (const HierarchyEdge& edge : targetEdges)
+                {
+                    if (edge.target == currentID)
+                        relax(targetID, edge.cost);
+                }
+            }
+
+            if (abstractPath.size() == 0)
+                return false;
+
+            // Refine every abstract edge into nodes
+            path.assign(1, start);
+            for (ui32 i = 1; i < abstractPath.size(); i++)
+            {
+                ui32 from = getCell(abstractPath[i - 1]);
+                ui32 to = getCell(abstractPath[i]);
+
+                if (getRegionID(from) != getRegionID(to))
+                {
+                    path.push_back(get2DCoordinates(to));
+                    continue;
+                }
+
+                std::vector<Vec2ui>& segment = context.getPathBuffer();
+                AStar(get2DCoordinates(from), get2DCoordinates(to), context, segment, m_regions->regions[getRegionID(from)]);
+                if (segment.empty())
+                {
+                    path.clear();
+                    return false;
+                }
+
+                path.insert(path.end(), segment.begin() + 1, segment.end());
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief The A* algorithm. Finds the shortest path between two nodes.
+         *
+         * All per-query data is kept in the given context, while the nodes of the NavMesh are only read.
+         *
+         * @tparam Heuristic The heuristic and cost policy of the search.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search.
+         * @param path Receives the shortest path between the start and the target nodes, or an empty list.
+         * @param region If set, the search does not leave this region.
+         */
+        template <typename Heuristic = OctileHeuristic>
+        void AStar(Vec2ui start, Vec2ui target, PathSearchContext& context, std::vector<Vec2ui>& path, const Region* region = nullptr)
+        {
+            ui32 expansionBudget = std::numeric_limits<ui32>::max();
+
+            path.clear();
+            beginPathSearch(start, context);
+            expandAStar<Heuristic>(target, context, expansionBudget, path, region);
+        }
+
+        /**
+         * @brief Appends the nodes of the best known path to a node, from the start node of the current query on.
+         *
+         * The parents are followed back from the node and the appended nodes are reversed in place afterwards, thus 
+         * no memory is allocated if the path has enough capacity.
+         *
+         * @param context The scratch memory holding the state of the search.
+         * @param index The index of the last node of the path.
+         * @param path The path to append the nodes to.
+         */
+        void appendPath(const PathSearchContext& context, ui32 index, std::vector<Vec2ui>& path) const
+        {
+            size_t firstNode = path.size();
+
+            for (; index != INVALID_INDEX; index = context.getParent(index))
+            {
+                path.push_back(get2DCoordinates(index));
+            }
+
+            std::reverse(path.begin() + firstNode, path.end());
+        }
+
+        /**
+         * @brief Bidirectional A*. Finds the shortest path between two nodes by searching from both of them at once.
+         *
+         * A forward search from the start node and a backward search from the target node run in turns, always 
+         * expanding the one with the smaller open set (New Bidirectional A*, Pijls and Post). Since the NavMesh is 
+         * undirected, both use the same neighbors. Whenever a search reaches a node that the other one has reached as 
+         * well, the cost of the joined path is recorded as `bestCost`. \n
+         * A node is closed by whichever search takes it first and is never expanded by the other one. Moreover, a 
+         * node `v` taken by the forward search is closed without being expanded if one of two lower bounds shows 
+         * that no shorter path leads through it:
+         *  - `g(v) + h(v, target) >= bestCost`, or
+         *  - `g(v) + F - h(v, start) >= bestCost`, where `F` is the smallest f-cost in the open set of the backward 
+         *    search, which is a lower bound on the cost of any path from the start node to the target node.
+         *
+         * The backward search works the same way. With a consistent heuristic, the path is optimal once either open 
+         * set has run empty or its smallest f-cost is no less than `bestCost`. An enclosed target is detected after 
+         * exploring its enclosure only.
+         *
+         * @tparam Heuristic The heuristic and cost policy of the search.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the forward search; its reverse context is used by the backward 
+         * search.
+         * @param path Receives the shortest path between the start and the target nodes, or an empty list.
+         */
+        template <typename Heuristic>
+        void bidirectionalAStar(Vec2ui start, Vec2ui target, PathSearchContext& context, std::vector<Vec2ui>& path)
+        {
+            path.clear();
+            if (!isWalkable(target))
+                return;
+
+            if (start == target)
+            {
+                path.push_back(start);
+                return;
+            }
+
+            PathSearchContext& reverseContext = context.getReverseContext();
+            PathSearchContext* contexts[2] = { &context, &reverseContext };
+            Vec2ui goals[2] = { target, start };
+
+            ui32 startNodeIndex = getIndex(start);
+            ui32 targetNodeIndex = getIndex(target);
+            ui32 goalIndices[2] = { targetNodeIndex, startNodeIndex };
+
+            context.beginQuery(getNumNodes());
+            context.setVisited(startNodeIndex, 0.0f, INVALID_INDEX);
+            context.getOpenSet().push(startNodeIndex, estimateNodeCost<Heuristic>(startNodeIndex, start, targetNodeIndex, target));
+
+            reverseContext.beginQuery(getNumNodes());
+            reverseContext.setVisited(targetNodeIndex, 0.0f, INVALID_INDEX);
+            reverseContext.getOpenSet().push(targetNodeIndex, estimateNodeCost<Heuristic>(targetNodeIndex, target, startNodeIndex, start));
+
+            f32 bestCost = INFINITY;
+            ui32 meetingNode = INVALID_INDEX;
+
+            while (!context.getOpenSet().empty() && !reverseContext.getOpenSet().empty())
+            {
+                if (context.getOpenSet().top().key >= bestCost || reverseContext.getOpenSet().top().key >= bestCost)
+                    break;
+
+                ui32 side = context.getOpenSet().size() <= reverseContext.getOpenSet().size() ? 0 : 1;
+                PathSearchContext& current = *contexts[side];
+                PathSearchContext& other = *contexts[1 - side];
+                IndexedHeap& openSet = current.getOpenSet();
+
+                ui32 currentIndex = openSet.pop();
+                if (other.isClosed(currentIndex))
+                    continue;
+
+                current.close(currentIndex);
+
+                Vec2ui currentPos = get2DCoordinates(currentIndex);
+                f32 currentG = current.getG(currentIndex);
+
+                if (currentG + estimateNodeCost<Heuristic>(currentIndex, currentPos, goalIndices[side], goals[side]) >= bestCost)
+                    continue;
+
+                if (!other.getOpenSet().empty() && 
+                    currentG + other.getOpenSet().top().key - estimateNodeCost<Heuristic>(currentIndex, currentPos, goalIndices[1 - side], goals[1 - side]) >= bestCost)
+                    continue;
+
+                for (uint8_t mask = getNeighborMask(currentPos); mask != 0; mask &= mask - 1)
+                {
+                    ui32 direction = std::countr_zero(mask);
+                    ui32 neighborIndex = currentIndex + m_directionOffsets[direction];
+                    if (current.isClosed(neighborIndex) || other.isClosed(neighborIndex))
+                        continue;
+
+                    f32 tentativeG = currentG + (isDiagonalDirection(direction) ? Heuristic::DIAGONAL_COST : Heuristic::STRAIGHT_COST);
+
+                    if (tentativeG < current.getG(neighborIndex))
+                    {
+                        Vec2ui neighborPos(currentPos.x + GRID_DIRECTIONS[direction][0], currentPos.y + GRID_DIRECTIONS[direction][1]);
+                        current.setVisited(neighborIndex, tentativeG, currentIndex);
+                        openSet.push(neighborIndex, tentativeG + estimateNodeCost<Heuristic>(neighborIndex, neighborPos, goalIndices[side], goals[side]));
+
+                        f32 joinedCost = tentativeG + other.getG(neighborIndex);
+                        if (joinedCost < bestCost)
+                        {
+                            bestCost = joinedCost;
+                            meetingNode = neighborIndex;
+                        }
+                    }
+                }
+            }
+
+            if (meetingNode == INVALID_INDEX)
+                return;
+
+            // The forward search holds the path from the start to the meeting node, the backward search the rest
+            appendPath(context, meetingNode, path);
+
+            for (ui32 nodeIndex = reverseContext.getParent(meetingNode); nodeIndex != INVALID_INDEX; nodeIndex = reverseContext.getParent(nodeIndex))
+            {
+                path.push_back(get2DCoordinates(nodeIndex));
+            }
+        }
+
+        /**
+         * @brief Expands the nodes of an A* search started with `beginPathSearch()` until it is finished or the budget 
+         * is used up.
+         *
+         * @tparam Heuristic The heuristic and cost policy of the search.
+         * @param target The position of the target node.
+         * @param context The scratch memory holding the state of the search.
+         * @param expansionBudget The maximum number of nodes to expand; reduced by the number of expanded nodes.
+         * @param path Receives the shortest path once it has been found.
+         * @param region If set, the search does not leave this region.
+         * @return PathStatus `SEARCHING` if the budget was used up first, `FOUND` or `NOT_FOUND` otherwise.
+         */
+        template <typename Heuristic = OctileHeuristic>
+        PathStatus expandAStar(Vec2ui target, PathSearchContext& context, ui32& expansionBudget, std::vector<Vec2ui>& path, const Region* region = nullptr)
+        {
+            IndexedHeap& openSet = context.getOpenSet();
+            ui32 targetNodeIndex = getIndex(target);
+
+            while (!openSet.empty())
+            {
+                if (expansionBudget == 0)
+                    return PathStatus::SEARCHING;
+                expansionBudget--;
+
+                ui32 currentIndex = openSet.pop();
+                context.close(currentIndex);
+
+                if (currentIndex == targetNodeIndex)
+                {
+                    path.clear();
+                    appendPath(context, currentIndex, path);
+
+                    return PathStatus::FOUND;
+                }
+
+                Vec2ui currentPos = get2DCoordinates(currentIndex);
+                f32 currentG = context.getG(currentIndex);
+
+                for (uint8_t mask = getNeighborMask(currentPos); mask != 0; mask &= mask - 1)
+                {
+                    ui32 direction = std::countr_zero(mask);
+                    ui32 neighborIndex = currentIndex + m_directionOffsets[direction];
+                    if (context.isClosed(neighborIndex))
+                        continue;
+
+                    Vec2ui neighborPos(currentPos.x + GRID_DIRECTIONS[direction][0], currentPos.y + GRID_DIRECTIONS[direction][1]);
+                    if (region != nullptr && !region->contains(neighborPos))
+                        continue;
+
+                    f32 tentativeG = currentG + (isDiagonalDirection(direction) ? Heuristic::DIAGONAL_COST : Heuristic::STRAIGHT_COST);
+
+                    if (tentativeG < context.getG(neighborIndex))
+                    {
+                        context.setVisited(neighborIndex, tentativeG, currentIndex);
+                        openSet.push(neighborIndex, tentativeG + estimateNodeCost<Heuristic>(neighborIndex, neighborPos, targetNodeIndex, target));
+                    }
+                }
+            }
+
+            return PathStatus::NOT_FOUND;
+        }
+
+        /**
+         * @brief Dijkstra's algorithm limited to one region. Computes the cost from a node to all nodes of the region.
+         *
+         * The costs can be read from the context with `getG()` until the next query starts. Since only the costs to 
+         * the abstract nodes of the region are needed, the search stops once all of them have been expanded.
+         *
+         * @param source The index of the node to start from.
+         * @param region The region that the search must not leave.
+         * @param context The scratch memory used by the search.
+         */
+        void regionDijkstra(ui32 source, const Region* region, PathSearchContext& context)
+        {
+            context.beginQuery(getNumNodes());
+            IndexedHeap& openSet = context.getOpenSet();
+
+            context.setVisited(source, 0.0f, INVALID_INDEX);
+            openSet.push(source, 0.0f);
+
+            ui32 remainingEntrances = static_cast<ui32>(m_regionEntrances[region->regionID].size());
+
+            while (!openSet.empty())
+            {
+                ui32 currentIndex = openSet.pop();
+                context.close(currentIndex);
+
+                if (m_hierarchyNodeIDs[currentIndex] != INVALID_INDEX && --remainingEntrances == 0)
+                    break;
+
+                Vec2ui currentPos = get2DCoordinates(currentIndex);
+                f32 currentG = context.getG(currentIndex);
+
+                // The region is a rectangle, thus its neighbors can be enumerated directly
+                ui32 minX = std::max(currentPos.x, region->minPos.x + 1) - 1;
+                ui32 minY = std::max(currentPos.y, region->minPos.y + 1) - 1;
+                ui32 maxX = std::min(currentPos.x + 1, region->maxPos.x);
+                ui32 maxY = std::min(currentPos.y + 1, region->maxPos.y);
+
+                for (ui32 y = minY; y <= maxY; y++)
+                {
+                    for (ui32 x = minX; x <= maxX; x++)
+                    {
+                        ui32 neighborIndex = x + y * m_width;
+                        if (neighborIndex == currentIndex || !m_walkability.isWalkable(x, y) || context.isClosed(neighborIndex))
+                            continue;
+
+                        f32 tentativeG = currentG + ((x != currentPos.x && y != currentPos.y) ? std::sqrt(2.0f) : 1.0f);
+
+                        if (tentativeG < context.getG(neighborIndex))
+                        {
+                            context.setVisited(neighborIndex, tentativeG, currentIndex);
+                            openSet.push(neighborIndex, tentativeG);
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Computes the intra-region edges of the abstract graph for one region.
+         *
+         * A region only adds edges to its own abstract nodes, thus different regions can be processed by different 
+         * threads, each with its own PathSearchContext.
+         *
+         * @param region The region whose abstract nodes are connected.
+         * @param context The scratch memory used by the searches.
+         */
+        void connectRegionEntrances(const Region* region, PathSearchContext& context)
+        {
+            const std::vector<ui32>& entrances = m_regionEntrances[region->regionID];
+
+            for (ui32 from : entrances)
+            {
+                regionDijkstra(m_hierarchyCells[from], region, context);
+
+                for (ui32 to : entrances)
+                {
+                    f32 cost = context.getG(m_hierarchyCells[to]);
+                    if (from != to && cost != INFINITY)
+                    {
+                        m_hierarchyEdges[from].push_back(HierarchyEdge{ to, cost });
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Creates the entrances along the border between two adjacent regions.
+         *
+         * The border is walked node by node on the side of the first region, while `across` points to the node on 
+         * the side of the second region. Each maximal run of positions at which both nodes are walkable is an entrance; 
+         * short runs get one transition in their middle, long runs one at each end. \n
+         * Diagonal crossings are only added where no straight crossing is next to them, since otherwise the nodes 
+         * involved are already connected through a straight one.
+         *
+         * @param first The first node of the border on the side of the first region.
+         * @param step The direction along the border.
+         * @param across The offset from a node of the first region to the facing node of the second region.
+         * @param length The number of nodes along the border.
+         */
+        void createEntrances(Vec2ui first, Vec2ui step, Vec2ui across, ui32 length)
+        {
+            auto getSide = [this, first, step, across](ui32 i, bool otherSide) {
+                return getIndex(Vec2ui(first.x + step.x * i + (otherSide ? across.x : 0), first.y + step.y * i + (otherSide ? across.y : 0)));
+            };
+            auto isOpen = [this, &getSide](ui32 i) {
+                return isWalkable(getSide(i, false)) && isWalkable(getSide(i, true));
+            };
+
+            ui32 i = 0;
+            while (i < length)
+            {
+                if (!isOpen(i))
+                {
+                    i++;
+                    continue;
+                }
+
+                ui32 runStart = i;
+                while (i < length && isOpen(i))
+                {
+                    i++;
+                }
+                ui32 runEnd = i - 1;
+
+                if (runEnd - runStart + 1 < 6)
+                {
+                    ui32 middle = (runStart + runEnd) / 2;
+                    addHierarchyTransition(getSide(middle, false), getSide(middle, true), 1.0f);
+                }
+                else
+                {
+                    addHierarchyTransition(getSide(runStart, false), getSide(runStart, true), 1.0f);
+                    addHierarchyTransition(getSide(runEnd, false), getSide(runEnd, true), 1.0f);
+                }
+            }
+
+            for (i = 0; i + 1 < length; i++)
+            {
+                if (isOpen(i) || isOpen(i + 1))
+                    continue;
+
+                if (isWalkable(getSide(i, false)) && isWalkable(getSide(i + 1, true)))
+                    addHierarchyTransition(getSide(i, false), getSide(i + 1, true), std::sqrt(2.0f));
+
+                if (isWalkable(getSide(i + 1, false)) && isWalkable(getSide(i, true)))
+                    addHierarchyTransition(getSide(i + 1, false), getSide(i, true), std::sqrt(2.0f));
+            }
+        }
+
+        /**
+         * @brief Adds an inter-region edge between two nodes of the abstract graph, creating them if needed.
+         *
+         * @param first The index of the node on one side of the border.
+         * @param second The index of the node on the other side of the border.
+         * @param cost The cost of moving between the two nodes.
+         */
+        void addHierarchyTransition(ui32 first, ui32 second, f32 cost)
+        {
+            auto getAbstractNode = [this](ui32 nodeIndex) {
+                if (m_hierarchyNodeIDs[nodeIndex] == INVALID_INDEX)
+                {
+                    ui32 id = static_cast<ui32>(m_hierarchyCells.size());
+                    m_hierarchyNodeIDs[nodeIndex] = id;
+                    m_hierarchyCells.push_back(nodeIndex);
+                    m_hierarchyEdges.push_back({});
+                    m_regionEntrances[getRegionID(nodeIndex)].push_back(id);
+                }
+                return m_hierarchyNodeIDs[nodeIndex];
+            };
+
+            ui32 firstID = getAbstractNode(first);
+            ui32 secondID = getAbstractNode(second);
+
+            m_hierarchyEdges[firstID].push_back(HierarchyEdge{ secondID, cost });
+            m_hierarchyEdges[secondID].push_back(HierarchyEdge{ firstID, cost });
+        }
+
+        /**
+         * @brief Checks whether a position lies within the NavMesh and is walkable.
+         *
+         * @param x The `x` coordinate; may be negative.
+         * @param y The `y` coordinate; may be negative.
+         * @return `true` if the node exists and is walkable, `false` otherwise.
+         */
+        bool isWalkable(i32 x, i32 y) const
+        {
+            if (x < 0 || y < 0 || x >= static_cast<i32>(m_width) || y >= static_cast<i32>(m_height))
+                return false;
+
+            return m_walkability.isWalkable(x, y);
+        }
+
+        /**
+         * @brief Moves from a node in a fixed direction until a jump point is found.
+         *
+         * A jump point is the target node or a node with a forced neighbor, i.e. a neighbor that can only be reached 
+         * optimally through this node because an obstacle blocks the way around it. \n
+         * Moving diagonally, a node is also a jump point if a straight jump from it along one of the two components of 
+         * the direction finds a jump point.
+         *
+         * @param x The `x` coordinate of the node to move from.
+         * @param y The `y` coordinate of the node to move from.
+         * @param dx The direction on the `x` axis (-1, 0 or 1).
+         * @param dy The direction on the `y` axis (-1, 0 or 1).
+         * @param targetIndex The index of the target node.
+         * @return ui32 The index of the jump point, or `INVALID_INDEX` if an obstacle or the border is hit first.
+         */
+        ui32 jump(i32 x, i32 y, i32 dx, i32 dy, ui32 targetIndex) const
+        {
+            while (true)
+            {
+                x += dx;
+                y += dy;
+
+                if (!isWalkable(x, y))
+                    return INVALID_INDEX;
+
+                ui32 index = x + y * m_width;
+                if (index == targetIndex)
+                    return index;
+
+                if (dx != 0 && dy != 0)
+                {
+                    if ((isWalkable(x - dx, y + dy) && !isWalkable(x - dx, y)) ||
+                        (isWalkable(x + dx, y - dy) && !isWalkable(x, y - dy)))
+                        return index;
+
+                    if (jump(x, y, dx, 0, targetIndex) != INVALID_INDEX || jump(x, y, 0, dy, targetIndex) != INVALID_INDEX)
+                        return index;
+                }
+                else if (dx != 0)
+                {
+                    if ((isWalkable(x + dx, y + 1) && !isWalkable(x, y + 1)) ||
+                        (isWalkable(x + dx, y - 1) && !isWalkable(x, y - 1)))
+                        return index;
+                }
+                else
+                {
+                    if ((isWalkable(x + 1, y + dy) && !isWalkable(x + 1, y)) ||
+                        (isWalkable(x - 1, y + dy) && !isWalkable(x - 1, y)))
+                        return index;
+                }
+            }
+        }
+
+        /**
+         * @brief Jump Point Search. Finds the shortest path between two nodes.
+         *
+         * Works like A*, but instead of adding every neighbor to the open set, each expanded node only follows the 
+         * directions that are not dominated by a path through its parent, and jumps along them to the next jump point. 
+         * Long straight and diagonal runs across open areas are therefore never expanded node by node. \n
+         * Since the NavMesh is an 8-connected grid with uniform costs, the found path is as short as the one of A*.
+         *
+         * @tparam Heuristic The heuristic and cost policy of the search.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search.
+         * @param path Receives all nodes of the shortest path between the start and the target nodes, or an empty list.
+         */
+        template <typename Heuristic>
+        void jumpPointSearch(Vec2ui start, Vec2ui target, PathSearchContext& context, std::vector<Vec2ui>& path)
+        {
+            path.clear();
+            context.beginQuery(getNumNodes());
+            IndexedHeap& openSet = context.getOpenSet();
+
+            ui32 startNodeIndex = getIndex(start);
+            ui32 targetNodeIndex = getIndex(target);
+
+            context.setVisited(startNodeIndex, 0.0f, INVALID_INDEX);
+            openSet.push(startNodeIndex, 0.0f);
+
+            while (!openSet.empty())
+            {
+                ui32 currentIndex = openSet.pop();
+                context.close(currentIndex);
+
+                if (currentIndex == targetNodeIndex)
+                {
+                    // Fill in the nodes between consecutive jump points, which always lie on a straight or diagonal 
+                    // line, walking back from the target node
+                    path.push_back(target);
+
+                    for (ui32 nodeIndex = currentIndex; context.getParent(nodeIndex) != INVALID_INDEX; nodeIndex = context.getParent(nodeIndex))
+                    {
+                        Vec2ui from = get2DCoordinates(nodeIndex);
+                        Vec2ui to = get2DCoordinates(context.getParent(nodeIndex));
+                        i32 dx = (to.x > from.x) - (to.x < from.x);
+                        i32 dy = (to.y > from.y) - (to.y < from.y);
+
+                        while (!(from == to))
+                        {
+                            from.x += dx;
+                            from.y += dy;
+                            path.push_back(from);
+                        }
+                    }
+
+                    std::reverse(path.begin(), path.end());
+                    return;
+                }
+
+                Vec2ui currentPos = get2DCoordinates(currentIndex);
+                i32 x = static_cast<i32>(currentPos.x);
+                i32 y = static_cast<i32>(currentPos.y);
+                f32 currentG = context.getG(currentIndex);
+
+                // Collect the directions that have to be followed from this node
+                i32 directions[8][2];
+                ui32 numDirections = 0;
+                ui32 parentIndex = context.getParent(currentIndex);
+
+                if (parentIndex == INVALID_INDEX)
+                {
+                    for (i32 v = -1; v <= 1; v++)
+                    {
+                        for (i32 u = -1; u <= 1; u++)
+                        {
+                            if (u == 0 && v == 0)
+                                continue;
+
+                            directions[numDirections][0] = u;
+                            directions[numDirections][1] = v;
+                            numDirections++;
+                        }
+                    }
+                }
+                else
+                {
+                    Vec2ui parentPos = get2DCoordinates(parentIndex);
+                    i32 dx = (currentPos.x > parentPos.x) - (currentPos.x < parentPos.x);
+                    i32 dy = (currentPos.y > parentPos.y) - (currentPos.y < parentPos.y);
+
+                    auto addDirection = [&directions, &numDirections](i32 u, i32 v) {
+                        directions[numDirections][0] = u;
+                        directions[numDirections][1] = v;
+                        numDirections++;
+                    };
+
+                    if (dx != 0 && dy != 0)
+                    {
+                        // Natural neighbors
+                        addDirection(0, dy);
+                        addDirection(dx, 0);
+                        addDirection(dx, dy);
+
+                        // Forced neighbors
+                        if (!isWalkable(x - dx, y))
+                            addDirection(-dx, dy);
+                        if (!isWalkable(x, y - dy))
+                            addDirection(dx, -dy);
+                    }
+                    else if (dx != 0)
+                    {
+                        addDirection(dx, 0);
+
+                        if (!isWalkable(x, y + 1))
+                            addDirection(dx, 1);
+                        if (!isWalkable(x, y - 1))
+                            addDirection(dx, -1);
+                    }
+                    else
+                    {
+                        addDirection(0, dy);
+
+                        if (!isWalkable(x + 1, y))
+                            addDirection(1, dy);
+                        if (!isWalkable(x - 1, y))
+                            addDirection(-1, dy);
+                    }
+                }
+
+                for (ui32 i = 0; i < numDirections; i++)
+                {
+                    ui32 jumpPointIndex = jump(x, y, directions[i][0], directions[i][1], targetNodeIndex);
+                    if (jumpPointIndex == INVALID_INDEX || context.isClosed(jumpPointIndex))
+                        continue;
+
+                    // Jump points are connected by a straight or diagonal line, thus its cost follows from the distances
+                    Vec2ui jumpPointPos = get2DCoordinates(jumpPointIndex);
+                    ui32 distX = jumpPointPos.x > currentPos.x ? jumpPointPos.x - currentPos.x : currentPos.x - jumpPointPos.x;
+                    ui32 distY = jumpPointPos.y > currentPos.y ? jumpPointPos.y - currentPos.y : currentPos.y - jumpPointPos.y;
+                    ui32 numDiagonal = std::min(distX, distY);
+                    f32 tentativeG = currentG + static_cast<f32>(std::max(distX, distY) - numDiagonal) * Heuristic::STRAIGHT_COST + 
+                        static_cast<f32>(numDiagonal) * Heuristic::DIAGONAL_COST;
+
+                    if (tentativeG < context.getG(jumpPointIndex))
+                    {
+                        context.setVisited(jumpPointIndex, tentativeG, currentIndex);
+                        openSet.push(jumpPointIndex, tentativeG + estimateNodeCost<Heuristic>(jumpPointIndex, jumpPointPos, targetNodeIndex, target));
+                    }
+                }
+            }
+        }
+
+    private:
+        static constexpr ui32 REPAIR_LIMIT_FRACTION = 8;                        /*!< A repair changing more than this fraction (1 / n) of the nodes rebuilds the region instead. */
+
+        bool m_isPreprocessed = false;                                          /*!< Indicates whether geometric preprocessing has been performed. */
+        ui32 m_width = 0, m_height = 0;                                         /*!< Width and height of the navigation mesh. */
+        RegionList* m_regions;                                                  /*!< The list of regions. */
+        WalkabilityGrid m_walkability;                                          /*!< The walkability of all nodes, one bit per node. */
+        f32 m_regionLengthOnX = 0.0f, m_regionLengthOnY = 0.0f;                 /*!< The lengths of a region on the `x` and `y` axes. */
+        std::vector<ui32> m_regionColumns;                                      /*!< The `x` index of the region of each column of nodes. */
+        std::vector<ui32> m_regionRows;                                         /*!< The first region ID of the region row of each row of nodes. */
+        std::vector<ui32> m_componentIDs;                                       /*!< The label of the connected component of each node; `INVALID_INDEX` if obstructable. */
+        mutable std::once_flag m_componentsFlag;                                /*!< Ensures the components are labeled once, see `ensureComponents()`. */
+        std::vector<ui32> m_componentParents;                                   /*!< The union-find forest of merged component labels. */
+        std::vector<uint8_t> m_componentRanks;                                  /*!< The rank of each component label within the forest. */
+        std::vector<ui32> m_componentFillMarks;                                 /*!< The nodes visited by the flood fills of `updateComponents()`. */
+        ui32 m_componentFillGeneration = 0;                                     /*!< The generation of the current flood fills. */
+        i32 m_directionOffsets[8] = {};                                         /*!< The index offsets of the 8 neighbors of a node, in the order of `GRID_DIRECTIONS`. */
+        std::vector<uint8_t> m_nextHops;                                        /*!< The direction of the next node on the shortest path from each node to each region, stored region by region. */
+        std::unique_ptr<MappedFile> m_nextHopsFile;                             /*!< The mapped file the next-hop table was loaded from, if any. */
+        uint8_t* m_nextHopData = nullptr;                                       /*!< The next-hop table in use; points into `m_nextHops` or `m_nextHopsFile`. */
+        std::unique_ptr<std::atomic<bool>[]> m_dirtyRegions;                    /*!< Whether the preprocessed data of each region is waiting to be rebuilt. */
+        std::vector<ui32> m_regionEditCounts;                                   /*!< The number of edits seen by each region, used to detect edits during a rebuild. */
+        std::deque<ui32> m_updateQueue;                                         /*!< The regions waiting to be rebuilt. */
+        std::vector<ui32> m_repairNodes;                                        /*!< The subtree of nodes repaired by `repairObstructableNode()`. */
+        std::vector<ui32> m_repairChain;                                        /*!< The nodes followed by `getCostToRegion()`, before their costs are known. */
+        std::vector<f32> m_repairCosts;                                         /*!< The costs memoized by `getCostToRegion()`. */
+        std::vector<ui32> m_repairMarks;                                        /*!< The repair generation in which the cost of each node was memoized. */
+        ui32 m_repairGeneration = 0;                                            /*!< The generation of the current repair. */
+        std::mutex m_updateMutex;                                               /*!< Guards the incremental update state. */
+        std::condition_variable m_updateWake;                                   /*!< Wakes the background thread when regions are queued. */
+        std::condition_variable m_updateDone;                                   /*!< Signals that the background thread finished a region. */
+        std::shared_mutex m_stateMutex;                                         /*!< Guards the node states against the background thread. */
+        std::thread m_updateThread;                                             /*!< The background thread rebuilding invalidated regions. */
+        bool m_isUpdating = false;                                              /*!< Whether the background thread is rebuilding a region. */
+        bool m_stopUpdates = false;                                             /*!< Tells the background thread to exit. */
+        PathSearchContext m_searchContext;                                      /*!< The search context used by queries that do not pass their own. */
+        bool m_isHierarchyBuilt = false;                                        /*!< Indicates whether the abstract graph for hierarchical pathfinding has been built. */
+        uint64_t m_hierarchyEpoch = 0;                                          /*!< The grid epoch at which the abstract graph was built. */
+        std::vector<ui32> m_hierarchyNodeIDs;                                   /*!< The abstract node ID of each node, or `INVALID_INDEX`. */
+        std::vector<ui32> m_hierarchyCells;                                     /*!< The node index of each abstract node. */
+        std::vector<std::vector<HierarchyEdge>> m_hierarchyEdges;               /*!< The inter- and intra-region edges of each abstract node. */
+        std::vector<std::vector<ui32>> m_regionEntrances;                       /*!< The abstract nodes of each region. */
+        std::vector<Vec2ui> m_landmarks;                                        /*!< The landmark nodes of `LandmarkHeuristic`. */
+        std::vector<f32> m_landmarkDistances;                                   /*!< The cost from each landmark to each node, stored node by node. */
+        std::atomic<bool> m_areLandmarksValid = false;                          /*!< Whether the landmark costs are still admissible. */
+        std::unique_ptr<ThreadPool> m_threadPool;                               /*!< The worker threads used by multithreaded operations; created on first use. */
+        std::vector<PathSearchContext> m_workerContexts;                        /*!< One search context per worker of `m_threadPool`. */
+        std::atomic<uint64_t> m_gridEpoch = 0;                                  /*!< Incremented every time a node changes its state. */
+
+        /**
+         * @brief Custom struct that holds a cached flow field.
+         *
+         */
+        struct FlowFieldCacheEntry
+        {
+            std::shared_ptr<FlowField> field;                                   /*!< The flow field. */
+            uint64_t lastUse;                                                   /*!< The value of `m_flowFieldUseCount` at the last request. */
+        };
+
+        std::map<std::vector<ui32>, FlowFieldCacheEntry> m_flowFieldCache;      /*!< The cached flow fields, by sorted target indices. */
+        ui32 m_flowFieldCacheCapacity = 16;                                     /*!< The maximum number of cached flow fields. */
+        uint64_t m_flowFieldUseCount = 0;                                       /*!< Counts the requests for flow fields. */
+        std::mutex m_flowFieldMutex;                                            /*!< Guards the flow field cache. */
+        PathSearchContext m_flowFieldContext;                                   /*!< The search context used to build flow fields. */
+
+        /**
+         * @brief Custom struct that holds a cached path.
+         *
+         */
+        struct PathCacheEntry
+        {
+            uint64_t key;                                                       /*!< The start node index in the upper and the target node index in the lower 32 bits. */
+            uint64_t epoch;                                                     /*!< The grid epoch at which the path was found. */
+            std::vector<Vec2ui> path;                                           /*!< The path. */
+        };
+
+        std::list<PathCacheEntry> m_pathCacheEntries;                           /*!< The cached paths, the most recently used first. */
+        std::unordered_map<uint64_t, std::list<PathCacheEntry>::iterator> m_pathCacheIndex; /*!< The cached paths by key. */
+        std::atomic<ui32> m_pathCacheCapacity = 0;                              /*!< The maximum number of cached paths; 0 disables the cache. */
+        PathCacheStats m_pathCacheStats;                                        /*!< The hit and miss statistics of the path cache. */
+        std::mutex m_pathCacheMutex;                                            /*!< Guards the path cache. */
+
+        PathStats m_pathStats;                                                  /*!< The aggregated measurements of the path queries. */
+        f32 m_slowQueryThreshold = 0.0f;                                        /*!< The minimum wall time of a query reported to `m_slowQueryCallback`. */
+        SlowQueryCallback m_slowQueryCallback;                                  /*!< Receives the measurements of slow queries, if set. */
+        std::mutex m_pathStatsMutex;                                            /*!< Guards the aggregates and the slow query callback. */
+    };
+
+    constexpr ui32 TIME_CHECK_INTERVAL = 64;        /*!< The number of expansions between two checks of a time limit. */
+
+    /**
+     * @brief Custom class that finds paths asynchronously within a budget per frame.
+     *
+     * Requests are answered one after another by A* searches that are advanced by `update()`. Each update expands 
+     * at most a fixed number of nodes and/or runs for at most a fixed time, thus a search that floods a large 
+     * navigation mesh (e.g. because there is no path) is spread over several frames instead of causing a hitch. 
+     * The result of a request can be polled with `getStatus()` and `collectPath()`, or is passed to a callback.
+     *
+     * All methods must be called from the same thread, usually the game loop.
+     */
+    class PathfindingService
+    {
+    public:
+        typedef std::function<void(ui32 handle, PathStatus status, const std::vector<Vec2ui>& path)> PathCallback; /*!< Receives the result of a request. */
+
+        /**
+         * @brief Constructs a new PathfindingService object.
+         *
+         * @param navmesh The navigation mesh to find paths in.
+         * @param maxExpansionsPerUpdate The maximum number of nodes expanded per `update()`; 0 means no limit.
+         * @param maxMicrosecondsPerUpdate The maximum time spent per `update()` in microseconds; 0 means no limit.
+         */
+        PathfindingService(NavMesh* navmesh, ui32 maxExpansionsPerUpdate = 1000, f32 maxMicrosecondsPerUpdate = 0.0f)
+            : m_navmesh(navmesh)
+            , m_maxExpansionsPerUpdate(maxExpansionsPerUpdate)
+            , m_maxMicrosecondsPerUpdate(maxMicrosecondsPerUpdate)
+        {}
+
+        /**
+         * @brief Submits a path request.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param callback If set, it is called with the result once the search is finished, after which the request 
+         * is released. Otherwise, the result is kept until it is collected with `collectPath()`.
+         * @return ui32 The handle of the request.
+         */
+        ui32 requestPath(Vec2ui start, Vec2ui target, PathCallback callback = nullptr)
+        {
+            ui32 handle = m_nextHandle++;
+
+            Request& request = m_requests[handle];
+            request.start = start;
+            request.target = target;
+            request.callback = std::move(callback);
+
+            m_queue.push_back(handle);
+
+            return handle;
+        }
+
+        /**
+         * @brief Cancels a request and releases it; its callback will not be called.
+         *
+         * @param handle The handle of the request.
+         */
+        void cancelRequest(ui32 handle)
+        {
+            m_requests.erase(handle);
+        }
+
+        /**
+         * @brief Advances the queued searches within the budget.
+         *
+         * Should be called once per frame. The time limit is checked every `TIME_CHECK_INTERVAL` expansions.
+         */
+        void update()
+        {
+            auto startTime = std::chrono::steady_clock::now();
+            ui32 expansionBudget = m_maxExpansionsPerUpdate > 0 ? m_maxExpansionsPerUpdate : std::numeric_limits<ui32>::max();
+
+            while (expansionBudget > 0 && !m_queue.empty())
+            {
+                ui32 handle = m_queue.front();
+                auto it = m_requests.find(handle);
+
+                // Skip cancelled requests
+                if (it == m_requests.end())
+                {
+                    m_queue.pop_front();
+                    continue;
+                }
+
+                Request& request = it->second;
+                if (request.status == PathStatus::QUEUED && m_navmesh->isReachable(request.start, request.target))
+                {
+                    m_navmesh->beginPathSearch(request.start, m_context);
+                    request.status = PathStatus::SEARCHING;
+                }
+
+                // Requests to unreachable targets are answered without a search
+                PathStatus status = PathStatus::NOT_FOUND;
+                if (request.status == PathStatus::SEARCHING)
+                {
+                    ui32 stepBudget = expansionBudget;
+                    if (m_maxMicrosecondsPerUpdate > 0.0f)
+                        stepBudget = std::min(stepBudget, TIME_CHECK_INTERVAL);
+
+                    ui32 remainingStepBudget = stepBudget;
+                    status = m_navmesh->continuePathSearch(request.target, m_context, remainingStepBudget, request.path);
+                    expansionBudget -= stepBudget - remainingStepBudget;
+                }
+
+                if (status != PathStatus::SEARCHING)
+                {
+                    m_queue.pop_front();
+                    request.status = status;
+
+                    if (request.callback)
+                    {
+                        PathCallback callback = std::move(request.callback);
+                        std::vector<Vec2ui> path = std::move(request.path);
+                        m_requests.erase(it);
+
+                        callback(handle, status, path);
+                    }
+                }
+
+                if (m_maxMicrosecondsPerUpdate > 0.0f)
+                {
+                    std::chrono::duration<f32, std::micro> elapsed = std::chrono::steady_clock::now() - startTime;
+                    if (elapsed.count() >= m_maxMicrosecondsPerUpdate)
+                        break;
+                }
+            }
+        }
+
+        /**
+         * @brief Gets the state of a request.
+         *
+         * @param handle The handle of the request.
+         * @return PathStatus The state of the request.
+         */
+        PathStatus getStatus(ui32 handle) const
+        {
+            auto it = m_requests.find(handle);
+            return it != m_requests.end() ? it->second.status : PathStatus::RELEASED;
+        }
+
+        /**
+         * @brief Collects the result of a finished request and releases it.
+         *
+         * @param handle The handle of the request.
+         * @param path Receives the path; it stays empty if no path was found.
+         * @return `true` if the request was finished and has been released, `false` if it is still in progress or unknown.
+         */
+        bool collectPath(ui32 handle, std::vector<Vec2ui>& path)
+        {
+            auto it = m_requests.find(handle);
+            if (it == m_requests.end() || it->second.status == PathStatus::QUEUED || it->second.status == PathStatus::SEARCHING)
+                return false;
+
+            path = std::move(it->second.path);
+            m_requests.erase(it);
+
+            return true;
+        }
+
+        /**
+         * @brief Sets the budget of each `update()`.
+         *
+         * @param maxExpansionsPerUpdate The maximum number of nodes expanded per `update()`; 0 means no limit.
+         * @param maxMicrosecondsPerUpdate The maximum time spent per `update()` in microseconds; 0 means no limit.
+         */
+        void setBudget(ui32 maxExpansionsPerUpdate, f32 maxMicrosecondsPerUpdate = 0.0f)
+        {
+            m_maxExpansionsPerUpdate = maxExpansionsPerUpdate;
+            m_maxMicrosecondsPerUpdate = maxMicrosecondsPerUpdate;
+        }
+
+        /**
+         * @brief Gets the number of requests whose search is not finished yet.
+         *
+         * @return ui32 The number of queued and running requests.
+         */
+        ui32 getNumPendingRequests() const
+        {
+            ui32 numPending = 0;
+            for (ui32 handle : m_queue)
+            {
+                numPending += m_requests.count(handle) ? 1 : 0;
+            }
+            return numPending;
+        }
+
+    private:
+        /**
+         * @brief Custom struct that holds a submitted path request.
+         *
+         */
+        struct Request
+        {
+            Vec2ui start;                                   /*!< The position of the start node. */
+            Vec2ui target;                                  /*!< The position of the target node. */
+            PathStatus status = PathStatus::QUEUED;         /*!< The state of the request. */
+            PathCallback callback;                          /*!< Receives the result, if set. */
+            std::vector<Vec2ui> path;                       /*!< The found path. */
+        };
+
+        NavMesh* m_navmesh;                                 /*!< The navigation mesh to find paths in. */
+        ui32 m_maxExpansionsPerUpdate;                      /*!< The maximum number of nodes expanded per update; 0 means no limit. */
+        f32 m_maxMicrosecondsPerUpdate;                     /*!< The maximum time spent per update in microseconds; 0 means no limit. */
+        ui32 m_nextHandle = 0;                              /*!< The handle of the next request. */
+        std::unordered_map<ui32, Request> m_requests;       /*!< All requests that have not been released yet. */
+        std::deque<ui32> m_queue;                           /*!< The handles of the requests whose search is not finished, in order. */
+        PathSearchContext m_context;                        /*!< Holds the state of the running search. */
+    };
+
+    /**
+     * @brief Custom incremental path planner based on D* Lite.
+     *
+     * D* Lite searches backwards from the goal to the start and keeps its search tree between plans. When nodes change 
+     * their state, only the part of the tree whose costs are affected is expanded again, and when the agent moves, 
+     * the tree is reused as it is. Replanning after a small change therefore costs a fraction of a new A* search. \n
+     * Costs follow the same model as `NavMesh::findPath()`: straight moves cost 1, diagonal moves cost √2, and moves 
+     * from or to obstructable nodes are not possible.
+     *
+     * Each planner holds two costs per node of the navigation mesh. It is not notified of changes automatically; 
+     * call `notifyNodeChanged()` after each call to `NavMesh::setObstructable()` or `NavMesh::setWalkable()` that 
+     * the planner should consider.
+     */
+    class DStarLite
+    {
+    public:
+        /**
+         * @brief Constructs a new DStarLite object.
+         *
+         * @param navmesh The navigation mesh to plan on.
+         * @param start The position of the agent.
+         * @param goal The position to plan to.
+         */
+        DStarLite(NavMesh* navmesh, Vec2ui start, Vec2ui goal)
+            : m_navmesh(navmesh)
+            , m_start(start)
+            , m_goal(goal)
+        {
+            ui32 numNodes = navmesh->getWidth() * navmesh->getHeight();
+
+            m_g.assign(numNodes, INFINITY);
+            m_rhs.assign(numNodes, INFINITY);
+            m_openSet.clear(numNodes);
+
+            ui32 goalIndex = navmesh->getIndex(goal);
+            m_rhs[goalIndex] = 0.0f;
+            m_openSet.push(goalIndex, calculateKey(goalIndex));
+        }
+
+        /**
+         * @brief Computes or repairs the shortest path from the start to the goal.
+         *
+         * @return `true` if there is a path, `false` otherwise.
+         */
+        bool computePath()
+        {
+            ui32 startIndex = m_navmesh->getIndex(m_start);
+
+            // Nodes whose key only differs from the key of the start by rounding errors are expanded as well, 
+            // otherwise a node on the shortest path might be left with an outdated cost
+            auto isBeforeStart = [this, startIndex]() {
+                f32 startKey = calculateKey(startIndex).primary;
+                return m_openSet.top().key.primary <= startKey + 1e-5f * std::max(1.0f, startKey);
+            };
+
+            while (!m_openSet.empty() && (isBeforeStart() || m_rhs[startIndex] > m_g[startIndex]))
+            {
+                ui32 index = m_openSet.top().index;
+                Key oldKey = m_openSet.top().key;
+                Key newKey = calculateKey(index);
+                m_numExpansions++;
+
+                if (oldKey < newKey)
+                {
+                    m_openSet.update(index, newKey);
+                }
+                else if (m_g[index] > m_rhs[index])
+                {
+                    // Overconsistent: the node got cheaper, its predecessors may get cheaper as well
+                    m_g[index] = m_rhs[index];
+                    m_openSet.remove(index);
+
+                    forEachNeighbor(index, [this, index](ui32 neighborIndex, f32 cost) {
+                        if (neighborIndex != m_navmesh->getIndex(m_goal))
+                        {
+                            m_rhs[neighborIndex] = std::min(m_rhs[neighborIndex], cost + m_g[index]);
+                            updateNode(neighborIndex);
+                        }
+                    });
+                }
+                else
+                {
+                    // Underconsistent: the node got more expensive (or blocked), all nodes that relied on it are recomputed
+                    m_g[index] = INFINITY;
+                    updateRhs(index);
+
+                    forEachNeighbor(index, [this](ui32 neighborIndex, f32) {
+                        updateRhs(neighborIndex);
+                    }, true);
+                }
+            }
+
+            // The start itself may stay overconsistent, thus its cost is given by its lookahead cost
+            return m_rhs[startIndex] != INFINITY;
+        }
+
+        /**
+         * @brief Gets the shortest path from the start to the goal, as found by the last `computePath()`.
+         *
+         * @return std::vector<Vec2ui> The path, or an empty list if there is none.
+         */
+        std::vector<Vec2ui> getPath()
+        {
+            std::vector<Vec2ui> path;
+            ui32 index = m_navmesh->getIndex(m_start);
+            ui32 goalIndex = m_navmesh->getIndex(m_goal);
+
+            if (m_rhs[index] == INFINITY)
+                return path;
+
+            path.push_back(m_start);
+
+            while (index != goalIndex)
+            {
+                index = getBestSuccessor(index);
+                if (index == INVALID_INDEX || path.size() >= m_g.size())
+                    return {};
+
+                path.push_back(m_navmesh->get2DCoordinates(index));
+            }
+
+            return path;
+        }
+
+        /**
+         * @brief Gets the next position on the shortest path from the start to the goal.
+         *
+         * @return Vec2ui The next position, or the start itself if it is the goal or there is no path.
+         */
+        Vec2ui getNextStep()
+        {
+            ui32 index = m_navmesh->getIndex(m_start);
+            if (m_rhs[index] == INFINITY || m_start == m_goal)
+                return m_start;
+
+            ui32 next = getBestSuccessor(index);
+            return next == INVALID_INDEX ? m_start : m_navmesh->get2DCoordinates(next);
+        }
+
+        /**
+         * @brief Moves the start of the plan, e.g. after the agent has taken a step.
+         *
+         * The search tree stays valid, since it is rooted at the goal. The keys already in the open set were computed 
+         * for the previous start; they stay comparable by adding the distance the start has moved to all new keys.
+         *
+         * @param start The new position of the agent.
+         */
+        void updateStart(Vec2ui start)
+        {
+            m_keyModifier += heuristic(m_start, start);
+            m_start = start;
+        }
+
+        /**
+         * @brief Informs the planner that a node has changed its state.
+         *
+         * The costs of all moves from and to the node are updated; the plan is repaired by the next `computePath()`.
+         *
+         * @param pos The position of the changed node.
+         */
+        void notifyNodeChanged(Vec2ui pos)
+        {
+            ui32 index = m_navmesh->getIndex(pos);
+            updateRhs(index);
+
+            forEachNeighbor(index, [this](ui32 neighborIndex, f32) {
+                updateRhs(neighborIndex);
+            }, true);
+        }
+
+        /**
+         * @brief Gets the number of nodes expanded by all calls to `computePath()` so far.
+         *
+         * @return ui32 The number of expanded nodes.
+         */
+        ui32 getNumExpansions() const
+        {
+            return m_numExpansions;
+        }
+
+    private:
+        /**
+         * @brief Custom struct that represents the two-part priority of a node; compared lexicographically.
+         *
+         */
+        struct Key
+        {
+            f32 primary;                            /*!< The estimated cost of the path through the node. */
+            f32 secondary;                          /*!< The cost from the node to the goal. */
+
+            bool operator<(const Key& other) const
+            {
+                return primary < other.primary || (primary == other.primary && secondary < other.secondary);
+            }
+        };
+
+        /**
+         * @brief Calculates the octile distance between two positions, the exact cost on an empty grid.
+         *
+         * @param a The first position.
+         * @param b The second position.
+         * @return f32 The octile distance.
+         */
+        f32 heuristic(const Vec2ui& a, const Vec2ui& b) const
+        {
+            return estimateCost<OctileHeuristic>(a, b);
+        }
+
+        /**
+         * @brief Calculates the priority of a node.
+         *
+         * @param index The index of the node.
+         * @return Key The priority of the node.
+         */
+        Key calculateKey(ui32 index)
+        {
+            f32 cost = std::min(m_g[index], m_rhs[index]);
+            return Key{ cost + heuristic(m_start, m_navmesh->get2DCoordinates(index)) + m_keyModifier, cost };
+        }
+
+        /**
+         * @brief Calls a function for each neighbor of a node that can be moved to, with the cost of the move.
+         *
+         * @param index The index of the node.
+         * @param function The function to call with the index of the neighbor and the cost.
+         * @param includeBlocked Set to `true` to also visit neighbors that cannot be moved to, with a cost of `INFINITY`.
+         */
+        template <typename Function>
+        void forEachNeighbor(ui32 index, Function function, bool includeBlocked = false)
+        {
+            Vec2ui pos = m_navmesh->get2DCoordinates(index);
+            bool isWalkable = m_navmesh->isWalkable(pos);
+
+            for (ui32 direction = 0; direction < 8; direction++)
+            {
+                i32 x = static_cast<i32>(pos.x) + GRID_DIRECTIONS[direction][0];
+                i32 y = static_cast<i32>(pos.y) + GRID_DIRECTIONS[direction][1];
+
+                if (x < 0 || y < 0 || x >= static_cast<i32>(m_navmesh->getWidth()) || y >= static_cast<i32>(m_navmesh->getHeight()))
+                    continue;
+
+                Vec2ui neighborPos(x, y);
+                bool canMove = isWalkable && m_navmesh->isWalkable(neighborPos);
+
+                if (canMove)
+                    function(m_navmesh->getIndex(neighborPos), GRID_DIRECTION_COSTS[direction]);
+                else if (includeBlocked)
+                    function(m_navmesh->getIndex(neighborPos), INFINITY);
+            }
+        }
+
+        /**
+         * @brief Gets the neighbor through which a node has its cheapest path to the goal.
+         *
+         * @param index The index of the node.
+         * @return ui32 The index of the neighbor, or `INVALID_INDEX` if there is none.
+         */
+        ui32 getBestSuccessor(ui32 index)
+        {
+            ui32 best = INVALID_INDEX;
+            f32 bestCost = INFINITY;
+
+            forEachNeighbor(index, [this, &best, &bestCost](ui32 neighborIndex, f32 cost) {
+                if (cost + m_g[neighborIndex] < bestCost)
+                {
+                    bestCost = cost + m_g[neighborIndex];
+                    best = neighborIndex;
+                }
+            });
+
+            return best;
+        }
+
+        /**
+         * @brief Recomputes the lookahead cost of a node from its neighbors and updates its place in the open set.
+         *
+         * @param index The index of the node.
+         */
+        void updateRhs(ui32 index)
+        {
+            if (index != m_navmesh->getIndex(m_goal))
+            {
+                f32 rhs = INFINITY;
+                forEachNeighbor(index, [this, &rhs](ui32 neighborIndex, f32 cost) {
+                    rhs = std::min(rhs, cost + m_g[neighborIndex]);
+                });
+                m_rhs[index] = rhs;
+            }
+
+            updateNode(index);
+        }
+
+        /**
+         * @brief Puts a node into the open set if its costs are inconsistent, or removes it otherwise.
+         *
+         * @param index The index of the node.
+         */
+        void updateNode(ui32 index)
+        {
+            if (m_g[index] != m_rhs[index])
+                m_openSet.update(index, calculateKey(index));
+            else
+                m_openSet.remove(index);
+        }
+
+    private:
+        NavMesh* m_navmesh;                         /*!< The navigation mesh to plan on. */
+        Vec2ui m_start;                             /*!< The position of the agent. */
+        Vec2ui m_goal;                              /*!< The position to plan to. */
+        f32 m_keyModifier = 0.0f;                   /*!< The total distance the start has moved. */
+        std::vector<f32> m_g;                       /*!< The cost from each node to the goal. */
+        std::vector<f32> m_rhs;                     /*!< The lookahead cost from each node to the goal, based on its neighbors. */
+        BasicIndexedHeap<Key> m_openSet;            /*!< The inconsistent nodes, ordered by their key. */
+        ui32 m_numExpansions = 0;                   /*!< The number of nodes expanded so far. */
+    };
+
+    /**
+     * @brief Anytime Repairing A* (ARA*). Finds a path quickly and keeps improving it while there is time left.
+     *
+     * The search starts as weighted A*, with the heuristic inflated by `initialWeight`. Such a search expands far 
+     * fewer nodes and finds a path whose cost is at most `weight` times the optimal cost. Afterwards, the weight 
+     * is lowered step by step down to 1, and each pass reuses the costs of all previous ones: it only expands the 
+     * nodes whose cost has dropped since they were last expanded. \n
+     * The work is split by `improvePath()` into pieces limited by a number of expansions and a time limit, so the 
+     * best path found so far can be used at any deadline. `getSuboptimalityBound()` reports how far from optimal 
+     * it can be.
+     */
+    class ARAStar
+    {
+    public:
+        /**
+         * @brief Constructs a new ARAStar object.
+         *
+         * @param navmesh The navigation mesh to search on.
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param initialWeight The weight of the heuristic in the first pass; at least 1, by default it is 3.
+         * @param weightStep The amount the weight is lowered by after each pass; by default it is 0.5.
+         */
+        ARAStar(NavMesh* navmesh, Vec2ui start, Vec2ui target, f32 initialWeight = 3.0f, f32 weightStep = 0.5f)
+            : m_navmesh(navmesh)
+            , m_target(target)
+            , m_weight(std::max(initialWeight, 1.0f))
+            , m_weightStep(weightStep)
+        {
+            ui32 numNodes = navmesh->getWidth() * navmesh->getHeight();
+            m_targetIndex = navmesh->getIndex(target);
+            m_isInconsistent.assign(numNodes, false);
+
+            for (ui32 direction = 0; direction < 8; direction++)
+            {
+                m_directionOffsets[direction] = GRID_DIRECTIONS[direction][0] + GRID_DIRECTIONS[direction][1] * static_cast<i32>(navmesh->getWidth());
+            }
+
+            if (!navmesh->isReachable(start, target))
+            {
+                m_status = PathStatus::NOT_FOUND;
+                return;
+            }
+
+            ui32 startIndex = navmesh->getIndex(start);
+            m_context.beginQuery(numNodes);
+            m_context.setVisited(startIndex, 0.0f, INVALID_INDEX);
+            m_context.getOpenSet().push(startIndex, m_weight * heuristic(start));
+        }
+
+        /**
+         * @brief Continues the search within a budget.
+         *
+         * Finishes as many passes as the budget allows. After each pass, the found path and its bound are updated 
+         * and the weight is lowered. The time limit is checked every `TIME_CHECK_INTERVAL` expansions.
+         *
+         * @param maxExpansions The maximum number of nodes to expand.
+         * @param maxMicroseconds The time limit in microseconds; 0 disables it.
+         * @return PathStatus `SEARCHING` if the path may still be improved, `FOUND` once it is optimal, or `NOT_FOUND` 
+         * if there is no path.
+         */
+        PathStatus improvePath(ui32 maxExpansions, f32 maxMicroseconds = 0.0f)
+        {
+            auto startTime = std::chrono::steady_clock::now();
+            IndexedHeap& openSet = m_context.getOpenSet();
+            ui32 numExpansions = 0;
+
+            while (m_status == PathStatus::SEARCHING)
+            {
+                // A pass ends once no node in the open set can lead to a cheaper path to the target
+                while (!openSet.empty() && m_context.getG(m_targetIndex) > openSet.top().key)
+                {
+                    if (numExpansions == maxExpansions)
+                        return m_status;
+
+                    if (maxMicroseconds > 0.0f && numExpansions % TIME_CHECK_INTERVAL == TIME_CHECK_INTERVAL - 1)
+                    {
+                        std::chrono::duration<f32, std::micro> elapsed = std::chrono::steady_clock::now() - startTime;
+                        if (elapsed.count() >= maxMicroseconds)
+                            return m_status;
+                    }
+
+                    expand(openSet.pop());
+                    numExpansions++;
+                }
+
+                finishPass();
+            }
+
+            return m_status;
+        }
+
+        /**
+         * @brief Checks whether a path has been found yet.
+         *
+         * @return `true` if a path is available, `false` otherwise.
+         */
+        bool hasPath() const
+        {
+            return !m_path.empty();
+        }
+
+        /**
+         * @brief Gets the best path found so far.
+         *
+         * @return const std::vector<Vec2ui>& The path, or an empty list if none has been found yet.
+         */
+        const std::vector<Vec2ui>& getPath() const
+        {
+            return m_path;
+        }
+
+        /**
+         * @brief Gets the bound on the suboptimality of the best path found so far.
+         *
+         * The cost of the path is at most this factor times the cost of the shortest path. The bound is the smaller 
+         * of the current weight and the cost of the path divided by the lowest f-cost of any node that might still 
+         * improve it.
+         *
+         * @return f32 The bound; 1 if the path is optimal, `INFINITY` if no path has been found yet.
+         */
+        f32 getSuboptimalityBound() const
+        {
+            return m_bound;
+        }
+
+        /**
+         * @brief Gets the weight of the heuristic in the current pass.
+         *
+         * @return f32 The weight.
+         */
+        f32 getWeight() const
+        {
+            return m_weight;
+        }
+
+        /**
+         * @brief Gets the number of nodes expanded by all calls to `improvePath()` so far.
+         *
+         * @return ui32 The number of expanded nodes.
+         */
+        ui32 getNumExpansions() const
+        {
+            return m_context.getNumClosed();
+        }
+
+    private:
+        /**
+         * @brief Estimates the cost from a node to the target with the octile distance.
+         *
+         * @param pos The position of the node.
+         * @return f32 The estimated cost.
+         */
+        f32 heuristic(const Vec2ui& pos) const
+        {
+            return estimateCost<OctileHeuristic>(pos, m_target);
+        }
+
+        /**
+         * @brief Expands a node of the open set.
+         *
+         * Neighbors that get cheaper are put into the open set, unless they have already been expanded in this pass. 
+         * Those are remembered as inconsistent and expanded again in the next pass.
+         *
+         * @param index The index of the node.
+         */
+        void expand(ui32 index)
+        {
+            m_context.close(index);
+
+            Vec2ui pos = m_navmesh->get2DCoordinates(index);
+            f32 g = m_context.getG(index);
+
+            for (uint8_t mask = m_navmesh->getNeighborMask(pos); mask != 0; mask &= mask - 1)
+            {
+                ui32 direction = std::countr_zero(mask);
+                ui32 neighborIndex = index + m_directionOffsets[direction];
+                f32 tentativeG = g + GRID_DIRECTION_COSTS[direction];
+
+                if (tentativeG >= m_context.getG(neighborIndex))
+                    continue;
+
+                m_context.setVisited(neighborIndex, tentativeG, index);
+
+                if (!m_context.isClosed(neighborIndex))
+                {
+                    Vec2ui neighborPos(pos.x + GRID_DIRECTIONS[direction][0], pos.y + GRID_DIRECTIONS[direction][1]);
+                    m_context.getOpenSet().push(neighborIndex, tentativeG + m_weight * heuristic(neighborPos));
+                }
+                else if (!m_isInconsistent[neighborIndex])
+                {
+                    m_isInconsistent[neighborIndex] = true;
+                    m_inconsistentNodes.push_back(neighborIndex);
+                }
+            }
+        }
+
+        /**
+         * @brief Publishes the result of a finished pass and prepares the next one.
+         *
+         * Stores the path and its bound. Unless the path is optimal, the weight is lowered, the inconsistent nodes are 
+         * moved into the open set, all keys are recomputed with the new weight and the closed set is emptied.
+         */
+        void finishPass()
+        {
+            f32 pathCost = m_context.getG(m_targetIndex);
+            if (pathCost == INFINITY)
+            {
+                // Every pass is complete, thus no path was missed because of the weight
+                m_status = PathStatus::NOT_FOUND;
+                return;
+            }
+
+            m_path.clear();
+            for (ui32 nodeIndex : m_context.reconstructPath(m_targetIndex))
+            {
+                m_path.push_back(m_navmesh->get2DCoordinates(nodeIndex));
+            }
+
+            IndexedHeap& openSet = m_context.getOpenSet();
+            std::vector<ui32> nodes = std::move(m_inconsistentNodes);
+            m_inconsistentNodes.clear();
+
+            while (!openSet.empty())
+            {
+                nodes.push_back(openSet.pop());
+            }
+
+            f32 lowestCost = INFINITY;
+            for (ui32 index : nodes)
+            {
+                m_isInconsistent[index] = false;
+                lowestCost = std::min(lowestCost, m_context.getG(index) + heuristic(m_navmesh->get2DCoordinates(index)));
+            }
+
+            m_bound = pathCost <= lowestCost ? 1.0f : std::min(m_weight, pathCost / lowestCost);
+
+            if (m_weight <= 1.0f || m_bound <= 1.0f)
+            {
+                m_bound = 1.0f;
+                m_status = PathStatus::FOUND;
+                return;
+            }
+
+            m_weight = std::max(1.0f, m_weight - m_weightStep);
+            m_context.clearClosed();
+
+            for (ui32 index : nodes)
+            {
+                openSet.push(index, m_context.getG(index) + m_weight * heuristic(m_navmesh->get2DCoordinates(index)));
+            }
+        }
+
+        NavMesh* m_navmesh;                         /*!< The navigation mesh to search on. */
+        Vec2ui m_target;                            /*!< The position of the target node. */
+        ui32 m_targetIndex;                         /*!< The index of the target node. */
+        f32 m_weight;                               /*!< The weight of the heuristic in the current pass. */
+        f32 m_weightStep;                           /*!< The amount the weight is lowered by after each pass. */
+        f32 m_bound = INFINITY;                     /*!< The suboptimality bound of the best path found so far. */
+        PathStatus m_status = PathStatus::SEARCHING;    /*!< The state of the search. */
+        PathSearchContext m_context;                /*!< The g-costs, parents, open and closed set of the search. */
+        std::vector<ui32> m_inconsistentNodes;      /*!< The nodes that got cheaper after they were expanded in this pass. */
+        std::vector<bool> m_isInconsistent;         /*!< Whether each node is in `m_inconsistentNodes`. */
+        std::vector<Vec2ui> m_path;                 /*!< The best path found so far. */
+        i32 m_directionOffsets[8] = {};             /*!< The index offsets of the 8 neighbors of a node. */
+    };
+
+    constexpr char TILED_NAVMESH_FILE_MAGIC[4] = { 'V', 'G', 'T', 'M' };   /*!< The first bytes of a tiled NavMesh file. */
+    constexpr ui32 TILED_NAVMESH_FILE_VERSION = 2;                          /*!< The version of the tiled NavMesh file format. */
+
+    /**
+     * @brief Custom struct that represents the header of a file read by `TiledNavMesh`.
+     *
+     * The header is followed by the tiles, row by row. Tile `i` is `tileBytes` long and starts at 
+     * `tileOffset + i * tileBytes`. It stores the walkability of its `tileSize * tileSize` nodes as a bitset of 64-bit 
+     * words, in which bit `x + y * tileSize` is set if the node at the position `(x, y)` within the tile is walkable. 
+     * Nodes of the last tiles that lie outside of the map are obstructable.
+     *
+     * All values are stored in the byte order of the machine that wrote the file, which is recorded in `byteOrder`. 
+     * Files written on a machine with a different byte order are rejected.
+     */
+    struct TiledNavMeshFileHeader
+    {
+        char magic[4];                              /*!< Identifies the file; always `VGTM`. */
+        ui32 byteOrder;                             /*!< Always `FILE_BYTE_ORDER_MARK` in the byte order of the writer. */
+        ui32 version;                               /*!< The version of the file format. */
+        ui32 width;                                 /*!< The width of the navigation mesh. */
+        ui32 height;                                /*!< The height of the navigation mesh. */
+        ui32 tileSize;                              /*!< The width and height of a tile. */
+        uint64_t tileBytes;                         /*!< The size of a tile in bytes; a multiple of 8. */
+        uint64_t tileOffset;                        /*!< The offset of the first tile from the start of the file. */
+    };
+
+    /**
+     * @brief Custom struct that holds the statistics of the tile cache of a TiledNavMesh.
+     *
+     */
+    struct TileCacheStats
+    {
+        uint64_t hits = 0;                          /*!< The number of tile lookups answered by a resident tile. */
+        uint64_t misses = 0;                        /*!< The number of tiles a query or an edit had to load itself. */
+        uint64_t prefetches = 0;                    /*!< The number of tiles loaded by the background loader. */
+        uint64_t evictions = 0;                     /*!< The number of tiles removed to make room for others. */
+        uint64_t writeBacks = 0;                    /*!< The number of changed tiles written back to the file. */
+    };
+
+    /**
+     * @brief Custom class that holds the scratch memory of path searches on a TiledNavMesh.
+     *
+     * The state of a search is stored per tile instead of per node of the world: the first time a search reaches a 
+     * tile, it allocates a block of `tileSize * tileSize` entries for it. Thus the memory grows with the area the 
+     * search explores and not with the size of the world. \n
+     * The context also holds on to the tiles the current search reads, so that most lookups skip the shared tile 
+     * cache. Keep the context between queries to avoid any setup cost.
+     */
+    class TiledPathSearchContext
+    {
+    public:
+        /**
+         * @brief Gets the number of nodes expanded by the last search.
+         *
+         * @return ui32 The number of closed nodes.
+         */
+        ui32 getNumClosed() const
+        {
+            return m_numClosed;
+        }
+
+        /**
+         * @brief Gets the number of tiles the last search has reached.
+         *
+         * @return ui32 The number of allocated blocks.
+         */
+        ui32 getNumBlocks() const
+        {
+            return static_cast<ui32>(m_blockTiles.size());
+        }
+
+    private:
+        friend class TiledNavMesh;
+
+        static constexpr ui32 NUM_CACHED_TILES = 16;            /*!< The number of tiles a search holds on to. */
+
+        std::unordered_map<ui32, ui32> m_blocks;                /*!< The block of each reached tile, by tile index. */
+        std::vector<ui32> m_blockTiles;                         /*!< The tile index of each block. */
+        std::vector<f32> m_g;                                   /*!< The cost of the best known path to each node, by local index. */
+        std::vector<ui32> m_parents;                            /*!< The predecessor of each node on that path, by local index. */
+        std::vector<uint8_t> m_closed;                          /*!< Whether each node has been expanded, by local index. */
+        IndexedHeap m_openSet;                                  /*!< The open set, by local index. */
+        ui32 m_numClosed = 0;                                   /*!< The number of expanded nodes. */
+        ui32 m_lastTile = INVALID_INDEX;                        /*!< The tile index of the last block looked up. */
+        ui32 m_lastBlock = INVALID_INDEX;                       /*!< The last block looked up. */
+        std::shared_ptr<const std::vector<uint64_t>> m_cachedTiles[NUM_CACHED_TILES];  /*!< The tiles read by the search, by tile index modulo `NUM_CACHED_TILES`. */
+        ui32 m_cachedTileIndices[NUM_CACHED_TILES] = {};        /*!< The tile index of each cached tile. */
+    };
+
+    /**
+     * @brief Custom navigation mesh for worlds that are too large to be kept in memory at once.
+     *
+     * The world is split into square tiles that are read from a file (see `TiledNavMeshFileHeader`) when they are 
+     * first needed. At most `maxResidentTiles` tiles are kept in memory; once the cache is full, the least recently 
+     * used tile is dropped, and written back to the file first if it was changed. \n
+     * Tiles can be loaded ahead of time by a background thread with `prefetchTiles()`, e.g. around the player. 
+     * `findPath()` also prefetches the tiles along the line from the start to the target node, so that they are 
+     * resident by the time the search reaches them. \n
+     * Searches run A* across tile borders with a `TiledPathSearchContext`, whose memory is bounded by the tiles the 
+     * search explores.
+     */
+    class TiledNavMesh
+    {
+    public:
+        /**
+         * @brief Constructs a new TiledNavMesh object by opening a file written by `createFile()`.
+         *
+         * Only the header is read; the tiles are loaded on demand.
+         *
+         * @param filepath The relative path of the file.
+         * @param maxResidentTiles The maximum number of tiles kept in memory; by default it is set to 64.
+         */
+        TiledNavMesh(const std::string& filepath, ui32 maxResidentTiles = 64)
+            : m_maxResidentTiles(std::max(maxResidentTiles, 1u))
+        {
+            m_file.open(filepath, std::ios::binary | std::ios::in | std::ios::out);
+            if (!m_file.is_open())
+            {
+                std::cout << "Could not read file " << filepath << std::endl;
+                return;
+            }
+
+            TiledNavMeshFileHeader header;
+            bool isTiledFile = m_file.read(reinterpret_cast<char*>(&header), sizeof(header)) && 
+                std::memcmp(header.magic, TILED_NAVMESH_FILE_MAGIC, sizeof(header.magic)) == 0;
+
+            if (isTiledFile && header.byteOrder != FILE_BYTE_ORDER_MARK)
+            {
+                std::cout << "Tiled navmesh file " << filepath << " was written on a machine with a different byte order" << std::endl;
+                m_file.close();
+                return;
+            }
+
+            if (!isTiledFile || header.version != TILED_NAVMESH_FILE_VERSION || header.tileSize == 0 ||
+                header.tileBytes < getNumTileWords(header.tileSize) * sizeof(uint64_t))
+            {
+                std::cout << "Invalid tiled navmesh file " << filepath << std::endl;
+                m_file.close();
+                return;
+            }
+
+            m_width = header.width;
+            m_height = header.height;
+            m_tileSize = header.tileSize;
+            m_numTilesX = (m_width + m_tileSize - 1) / m_tileSize;
+            m_tileBytes = header.tileBytes;
+            m_tileOffset = header.tileOffset;
+
+            m_loaderThread = std::thread(&TiledNavMesh::loadLoop, this);
+        }
+
+        /**
+         * @brief Destroys the TiledNavMesh object.
+         *
+         * Stops the background loader and writes all changed tiles back to the file.
+         */
+        ~TiledNavMesh()
+        {
+            if (m_loaderThread.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_loaderMutex);
+                    m_stopLoading = true;
+                }
+                m_loaderWake.notify_all();
+                m_loaderThread.join();
+            }
+
+            if (isOpen())
+                flush();
+        }
+
+        TiledNavMesh(const TiledNavMesh&) = delete;
+        TiledNavMesh& operator=(const TiledNavMesh&) = delete;
+
+        /**
+         * @brief Writes a tiled NavMesh file, one tile at a time.
+         *
+         * The walkability of the nodes is queried tile by tile, thus worlds larger than memory can be written as well.
+         *
+         * @param filepath The relative path of the file.
+         * @param width The width of the navigation mesh.
+         * @param height The height of the navigation mesh.
+         * @param tileSize The width and height of a tile, e.g. 64.
+         * @param isWalkable Returns whether the node at `(x, y)` is walkable.
+         * @return `true` if the file was written, `false` otherwise.
+         */
+        static bool createFile(const std::string& filepath, ui32 width, ui32 height, ui32 tileSize, const std::function<bool(ui32 x, ui32 y)>& isWalkable)
+        {
+            if (tileSize == 0)
+            {
+                std::cout << "The tile size must be positive!" << std::endl;
+                return false;
+            }
+
+            ui32 numTilesX = (width + tileSize - 1) / tileSize;
+            ui32 numTilesY = (height + tileSize - 1) / tileSize;
+
+            TiledNavMeshFileHeader header = {};
+            std::memcpy(header.magic, TILED_NAVMESH_FILE_MAGIC, sizeof(header.magic));
+            header.byteOrder = FILE_BYTE_ORDER_MARK;
+            header.version = TILED_NAVMESH_FILE_VERSION;
+            header.width = width;
+            header.height = height;
+            header.tileSize = tileSize;
+            header.tileBytes = getNumTileWords(tileSize) * sizeof(uint64_t);
+            header.tileOffset = sizeof(TiledNavMeshFileHeader);
+
+            std::ofstream stream(filepath, std::ios::binary);
+            if (!stream.is_open())
+            {
+                std::cout << "Could not write file " << filepath << std::endl;
+                return false;
+            }
+
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            std::vector<uint64_t> tile(getNumTileWords(tileSize));
+            for (ui32 tileY = 0; tileY < numTilesY; tileY++)
+            {
+                for (ui32 tileX = 0; tileX < numTilesX; tileX++)
+                {
+                    std::fill(tile.begin(), tile.end(), 0);
+
+                    for (ui32 y = 0; y < tileSize && tileY * tileSize + y < height; y++)
+                    {
+                        for (ui32 x = 0; x < tileSize && tileX * tileSize + x < width; x++)
+                        {
+                            if (isWalkable(tileX * tileSize + x, tileY * tileSize + y))
+                            {
+                                ui32 bit = x + y * tileSize;
+                                tile[bit / 64] |= uint64_t(1) << (bit % 64);
+                            }
+                        }
+                    }
+
+                    stream.write(reinterpret_cast<const char*>(tile.data()), header.tileBytes);
+                }
+            }
+
+            return stream.good();
+        }
+
+        /**
+         * @brief Checks whether the file could be opened.
+         *
+         * @return `true` if the navigation mesh can be used, `false` otherwise.
+         */
+        bool isOpen() const
+        {
+            return m_tileSize != 0;
+        }
+
+        /**
+         * @brief Gets the width of the navigation mesh.
+         *
+         * @return ui32 The width.
+         */
+        ui32 getWidth() const
+        {
+            return m_width;
+        }
+
+        /**
+         * @brief Gets the height of the navigation mesh.
+         *
+         * @return ui32 The height.
+         */
+        ui32 getHeight() const
+        {
+            return m_height;
+        }
+
+        /**
+         * @brief Gets the width and height of a tile.
+         *
+         * @return ui32 The tile size.
+         */
+        ui32 getTileSize() const
+        {
+            return m_tileSize;
+        }
+
+        /**
+         * @brief Checks whether a position lies within the navigation mesh.
+         *
+         * @param pos The position.
+         * @return `true` if the position is valid, `false` otherwise.
+         */
+        bool isValid(const Vec2ui& pos) const
+        {
+            return pos.x < m_width && pos.y < m_height;
+        }
+
+        /**
+         * @brief Checks whether a node is walkable, loading its tile if needed.
+         *
+         * @param pos The position of the node.
+         * @return `true` if the node is walkable, `false` otherwise.
+         */
+        bool isWalkable(const Vec2ui& pos)
+        {
+            if (!isOpen() || !isValid(pos))
+                return false;
+
+            std::shared_ptr<const std::vector<uint64_t>> tile = getTile(getTileIndex(pos), false);
+            return tile && readBit(*tile, getLocalBit(pos));
+        }
+
+        /**
+         * @brief Makes a node walkable.
+         *
+         * The change is kept in the resident tile and written to the file once the tile is evicted or `flush()` is 
+         * called. Searches that are running keep seeing the previous state.
+         *
+         * @param pos The position of the node.
+         */
+        void setWalkable(const Vec2ui& pos)
+        {
+            setState(pos, true);
+        }
+
+        /**
+         * @brief Makes a node obstructable.
+         *
+         * The change is kept in the resident tile and written to the file once the tile is evicted or `flush()` is 
+         * called. Searches that are running keep seeing the previous state.
+         *
+         * @param pos The position of the node.
+         */
+        void setObstructable(const Vec2ui& pos)
+        {
+            setState(pos, false);
+        }
+
+        /**
+         * @brief Writes all changed resident tiles back to the file.
+         *
+         * @return `true` if all tiles were written, `false` otherwise.
+         */
+        bool flush()
+        {
+            std::lock_guard<std::mutex> lock(m_tileMutex);
+
+            bool isWritten = true;
+            for (ResidentTile& tile : m_residentTiles)
+            {
+                if (tile.isDirty)
+                {
+                    isWritten &= writeTile(tile.tileIndex, *tile.bits);
+                    tile.isDirty = false;
+                }
+            }
+
+            return isWritten;
+        }
+
+        /**
+         * @brief Loads the tiles around a position on the background thread.
+         *
+         * Returns right away. Requests that are still waiting when the queue grows beyond `maxResidentTiles` are 
+         * dropped, as their tiles would be evicted again before they are used.
+         *
+         * @param center The position in the middle of the area.
+         * @param radius The number of tiles to load on each side of the tile of `center`.
+         */
+        void prefetchTiles(const Vec2ui& center, ui32 radius)
+        {
+            if (!isOpen() || !isValid(center))
+                return;
+
+            ui32 numTilesY = (m_height + m_tileSize - 1) / m_tileSize;
+            ui32 centerX = center.x / m_tileSize;
+            ui32 centerY = center.y / m_tileSize;
+
+            std::vector<ui32> tileIndices;
+            for (ui32 tileY = centerY - std::min(centerY, radius); tileY <= std::min(centerY + radius, numTilesY - 1); tileY++)
+            {
+                for (ui32 tileX = centerX - std::min(centerX, radius); tileX <= std::min(centerX + radius, m_numTilesX - 1); tileX++)
+                {
+                    tileIndices.push_back(tileX + tileY * m_numTilesX);
+                }
+            }
+
+            requestTiles(tileIndices);
+        }
+
+        /**
+         * @brief Finds the shortest path between two nodes with A*.
+         *
+         * Uses the search context owned by the navigation mesh, thus it must not be called from several threads at 
+         * once.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param maxExpansions The search gives up after this number of expanded nodes; by default it is unlimited.
+         * @return std::vector<Vec2ui> The shortest path, or an empty list if there is none.
+         */
+        std::vector<Vec2ui> findPath(Vec2ui start, Vec2ui target, ui32 maxExpansions = std::numeric_limits<ui32>::max())
+        {
+            return findPath(start, target, m_searchContext, maxExpansions);
+        }
 
-            ui32 startRegionID = startNode.regionID;
-            ui32 targetRegionID = targetNode.regionID;
+        /**
+         * @brief Finds the shortest path between two nodes with A* using a caller-owned search context.
+         *
+         * Tiles are only shared through the cache, thus each thread can run its own queries concurrently as long as 
+         * it passes its own context. Without a limit, a search for an unreachable target explores its whole part of 
+         * the world; `maxExpansions` bounds both the time and the memory of such a search.
+         *
+         * @param start The position of the start node.
+         * @param target The position of the target node.
+         * @param context The scratch memory used by the search.
+         * @param maxExpansions The search gives up after this number of expanded nodes; by default it is unlimited.
+         * @return std::vector<Vec2ui> The shortest path, or an empty list if there is none.
+         */
+        std::vector<Vec2ui> findPath(Vec2ui start, Vec2ui target, TiledPathSearchContext& context, ui32 maxExpansions = std::numeric_limits<ui32>::max())
+        {
+            if (!isWalkable(start) || !isWalkable(target))
+                return {};
 
-            // If start and target nodes are in the same region, call A* to find the shortest path.
-            if (startRegionID == targetRegionID)
-            {
-                return findPath(start, target);
-            }
+            prefetchLine(start, target);
+            beginQuery(context);
 
-            // Check if there is at least one precomputed path from the start node stored in `m_adjList`.
-            if (m_adjList[getIndex(startNode.pos)].size() == 0)
-            {
-                std::cout << "Could not find any path from the start node!" << std::endl;
-                return {};
-            }
+            ui32 startIndex = getLocalIndex(context, getTileIndex(start), getLocalBit(start));
+            ui32 targetIndex = getLocalIndex(context, getTileIndex(target), getLocalBit(target));
 
-            ui32 startNodeIndex = getIndex(startNode.pos);
-            std::vector<Vec2ui> pathToRegion = m_adjList[startNodeIndex][targetRegionID];
+            context.m_g[startIndex] = 0.0f;
+            context.m_openSet.push(startIndex, estimateCost<OctileHeuristic>(start, target));
 
-            // Check if there is a precomputed path from the start node to the region in which the target node is.
-            if (pathToRegion.size() == 0)
+            while (!context.m_openSet.empty() && context.m_numClosed < maxExpansions)
             {
-                std::cout << "No path found to target region!" << std::endl;
-                return {};
-            }
+                ui32 currentIndex = context.m_openSet.pop();
+                context.m_closed[currentIndex] = 1;
+                context.m_numClosed++;
 
-            // Retrieve the last node from the newly found path and check whether it is the target node.
-            Vec2ui pathEndNode = pathToRegion[pathToRegion.size() - 1];
-            if (pathEndNode == target)
-            {
-                // Reached destination
-                return pathToRegion;
-            }
+                if (currentIndex == targetIndex)
+                {
+                    std::vector<Vec2ui> path;
+                    for (ui32 nodeIndex = targetIndex; nodeIndex != INVALID_INDEX; nodeIndex = context.m_parents[nodeIndex])
+                    {
+                        path.push_back(getPosition(context, nodeIndex));
+                    }
+                    std::reverse(path.begin(), path.end());
 
-            // If the end node of the path is not the target, get the shortest path between it and the target.
-            std::vector<Vec2ui> pathWithinRegion = findPath(pathEndNode, target);
-            if (pathWithinRegion.size() == 0)
-            {
-                std::cout << "No path found inside target region!" << std::endl;
-                return {};
+                    return path;
+                }
+
+                Vec2ui currentPos = getPosition(context, currentIndex);
+                f32 currentG = context.m_g[currentIndex];
+
+                for (ui32 direction = 0; direction < 8; direction++)
+                {
+                    // Moves off the left or top border wrap around to large coordinates and fail the validity check
+                    Vec2ui neighborPos(currentPos.x + GRID_DIRECTIONS[direction][0], currentPos.y + GRID_DIRECTIONS[direction][1]);
+                    if (!isValid(neighborPos))
+                        continue;
+
+                    ui32 tileIndex = getTileIndex(neighborPos);
+                    ui32 localBit = getLocalBit(neighborPos);
+                    const std::vector<uint64_t>* tile = getSearchTile(context, tileIndex);
+                    if (!tile || !readBit(*tile, localBit))
+                        continue;
+
+                    ui32 neighborIndex = getLocalIndex(context, tileIndex, localBit);
+                    if (context.m_closed[neighborIndex])
+                        continue;
+
+                    f32 tentativeG = currentG + GRID_DIRECTION_COSTS[direction];
+                    if (tentativeG < context.m_g[neighborIndex])
+                    {
+                        context.m_g[neighborIndex] = tentativeG;
+                        context.m_parents[neighborIndex] = currentIndex;
+                        context.m_openSet.push(neighborIndex, tentativeG + estimateCost<OctileHeuristic>(neighborPos, target));
+                    }
+                }
             }
 
-            // Combine the two paths together: (start -> endNode) + (endNode -> target)
-            pathToRegion.insert(pathToRegion.end(), pathWithinRegion.begin(), pathWithinRegion.end());
+            return {};
+        }
 
-            return pathToRegion;
+        /**
+         * @brief Gets the number of tiles currently kept in memory.
+         *
+         * @return ui32 The number of resident tiles.
+         */
+        ui32 getNumResidentTiles()
+        {
+            std::lock_guard<std::mutex> lock(m_tileMutex);
+            return static_cast<ui32>(m_residentTiles.size());
         }
 
         /**
-         * @brief Saves the structure of a navigation mesh to a file.
+         * @brief Gets the memory used by the resident tiles.
          *
-         * The file will consist of 3 main lines: the first one will represent the width, the second one will be the 
-         * height and the third will be the pattern. \n
-         * 
-         * Example: \n
-         *      10 \n
-         *      1 \n
-         *      oowowowoww \n
-         * Where `o` stands for the `obstructable` state, and `w` for `walkable`.
+         * Tiles that were evicted while a search still reads them are freed once the search has finished.
          *
-         * @param filepath The relative path of the file, including the filename; if the file does not exist, it will 
-         * be created automatically.
+         * @return size_t The size of the resident tiles in bytes.
          */
-        void saveToFile(const std::string& filepath)
+        size_t getMemoryUsage()
         {
-            std::ofstream stream(filepath);
-            stream << m_width << '\n';
-            stream << m_height << '\n';
-            for (NodeData node : m_nodes)
-            {
-                if (node.state == NodeState::WALKABLE)
-                    stream << "w";
-                else
-                    stream << "o";
-            }
-            stream.close();
+            return getNumResidentTiles() * getNumTileWords(m_tileSize) * sizeof(uint64_t);
         }
 
         /**
-         * @brief Sets the state of a NodeData object to `obstructable`.
+         * @brief Gets the hit and miss statistics of the tile cache.
          *
-         * @param pos The 2D position of the NodeData object.
+         * @return TileCacheStats The statistics since the last reset.
          */
-        void setObstructable(Vec2ui pos)
+        TileCacheStats getTileCacheStats()
         {
-            ui32 index = getIndex(pos);
-            if (m_nodes[index].state != NodeState::OBSTRUCTABLE)
-            {
-                m_nodes[index].state = NodeState::OBSTRUCTABLE;
-            }
+            std::lock_guard<std::mutex> lock(m_tileMutex);
+            return m_tileCacheStats;
         }
 
         /**
-         * @brief Sets the state of a NodeData object to `walkable`.
+         * @brief Resets the statistics of the tile cache.
          *
-         * @param pos The 2D position of the NodeData object.
          */
-        void setWalkable(Vec2ui pos)
+        void resetTileCacheStats()
         {
-            ui32 index = getIndex(pos);
-            if (m_nodes[index].state != NodeState::WALKABLE)
-            {
-                m_nodes[index].state = NodeState::WALKABLE;
-            }
+            std::lock_guard<std::mutex> lock(m_tileMutex);
+            m_tileCacheStats = TileCacheStats();
         }
 
+    private:
         /**
-         * @brief Gets the width of the navigation mesh.
+         * @brief Custom struct that represents a tile kept in memory.
          *
-         * @return ui32 Width of the navigation mesh.
+         * The bits of a tile are never changed in place: an edit replaces them by a changed copy, thus searches can 
+         * keep reading the previous bits without holding a lock.
          */
-        ui32 getWidth()
+        struct ResidentTile
         {
-            return m_width;
-        }
+            ui32 tileIndex;                                     /*!< The index of the tile, `x + y * numTilesX`. */
+            std::shared_ptr<const std::vector<uint64_t>> bits;  /*!< The walkability of the nodes of the tile. */
+            bool isDirty;                                       /*!< Whether the tile has changed since it was read. */
+        };
 
         /**
-         * @brief Gets the height of the navigation mesh.
+         * @brief Gets the number of 64-bit words of a tile.
          *
-         * @return ui32 Height of the navigation mesh.
+         * @param tileSize The width and height of a tile.
+         * @return size_t The number of words.
          */
-        ui32 getHeight()
+        static size_t getNumTileWords(ui32 tileSize)
         {
-            return m_height;
+            return (static_cast<size_t>(tileSize) * tileSize + 63) / 64;
         }
 
         /**
-         * @brief Gets the 2D coordinates of a NodeData object.
+         * @brief Reads a bit of a tile.
          *
-         * @param index The index of the NodeData object within the NavMesh.
-         * @return Vec2ui 2D coordinates of the NodeData object.
+         * @param tile The bits of the tile.
+         * @param bit The index of the bit.
+         * @return `true` if the bit is set, `false` otherwise.
          */
-        Vec2ui get2DCoordinates(ui32 index)
+        static bool readBit(const std::vector<uint64_t>& tile, ui32 bit)
         {
-            ui32 x = index % m_width;
-            ui32 y = (index - x) / m_width;
-            return Vec2ui(x, y);
+            return (tile[bit / 64] >> (bit % 64)) & 1;
         }
 
         /**
-         * @brief Gets the index of a NodeData object within the NavMesh.
+         * @brief Gets the index of the tile a node lies in.
          *
-         * @param pos The 2D coordinates of the NodeData object.
-         * @return ui32 The index of the NodeData object.
+         * @param pos The position of the node.
+         * @return ui32 The index of the tile.
          */
-        ui32 getIndex(Vec2ui pos)
+        ui32 getTileIndex(const Vec2ui& pos) const
         {
-            return pos.x + pos.y * m_width;
+            return pos.x / m_tileSize + pos.y / m_tileSize * m_numTilesX;
         }
 
         /**
-         * @brief Gets a NodeData object based on its 2D coordinates.
+         * @brief Gets the index of the bit of a node within its tile.
          *
-         * @param pos The 2D coordinates of the NodeData object.
-         * @return NodeData& The NodeData object.
+         * @param pos The position of the node.
+         * @return ui32 The index of the bit.
          */
-        NodeData& getNode(Vec2ui pos)
+        ui32 getLocalBit(const Vec2ui& pos) const
         {
-            return m_nodes[getIndex(pos)];
+            return pos.x % m_tileSize + pos.y % m_tileSize * m_tileSize;
         }
 
-    private:
         /**
-         * @brief Creates Region objects and assigns nodes to each region.
+         * @brief Gets a tile from the cache, or reads it from the file if it is not resident.
          *
-         * Used for geometric preprocessing.
-         * It divides the NavMesh into regions and determines which region each node should be assigned to.
+         * The file is read without holding the lock of the cache, thus other threads keep using the resident tiles 
+         * meanwhile. If a changed tile was written back during the read, the read may be outdated and is repeated.
          *
-         * @param regionLengthOnX The amount of regions on the `x` axis.
-         * @param regionLengthOnY The amount of regions on the `y` axis.
+         * @param tileIndex The index of the tile.
+         * @param isPrefetch Set to `true` if the background loader requested the tile.
+         * @return std::shared_ptr<const std::vector<uint64_t>> The bits of the tile, or `nullptr` if it could not be read.
          */
-        void createRegions(f32 regionLengthOnX, f32 regionLengthOnY)
+        std::shared_ptr<const std::vector<uint64_t>> getTile(ui32 tileIndex, bool isPrefetch)
         {
-            ui32 numRegionsX = std::ceil(static_cast<f32>(m_width) / regionLengthOnX);
-            ui32 numRegionsY = std::ceil(static_cast<f32>(m_height) / regionLengthOnY);
+            uint64_t numWriteBacks;
+            {
+                std::lock_guard<std::mutex> lock(m_tileMutex);
 
-            m_regions = new RegionList(numRegionsX, numRegionsY);
+                auto it = m_tileIndex.find(tileIndex);
+                if (it != m_tileIndex.end())
+                {
+                    // Move the tile to the front, which holds the most recently used tiles
+                    m_residentTiles.splice(m_residentTiles.begin(), m_residentTiles, it->second);
+                    if (!isPrefetch)
+                        m_tileCacheStats.hits++;
 
-            for (ui32 y = 0; y < m_height; y++)
+                    return it->second->bits;
+                }
+
+                numWriteBacks = m_numWriteBacks;
+            }
+
+            while (true)
             {
-                ui32 yIndex = std::floor(static_cast<f32>(y) / regionLengthOnY);
+                auto bits = std::make_shared<std::vector<uint64_t>>(getNumTileWords(m_tileSize));
+                if (!readTile(tileIndex, *bits))
+                    return nullptr;
 
-                for (ui32 x = 0; x < m_width; x++)
+                std::lock_guard<std::mutex> lock(m_tileMutex);
+
+                auto it = m_tileIndex.find(tileIndex);
+                if (it != m_tileIndex.end())
+                {
+                    m_residentTiles.splice(m_residentTiles.begin(), m_residentTiles, it->second);
+                    return it->second->bits;
+                }
+
+                if (numWriteBacks != m_numWriteBacks)
                 {
-                    ui32 xIndex = std::floor(static_cast<f32>(x) / regionLengthOnX);
+                    numWriteBacks = m_numWriteBacks;
+                    continue;
+                }
+
+                if (isPrefetch)
+                    m_tileCacheStats.prefetches++;
+                else
+                    m_tileCacheStats.misses++;
 
-                    ui32 regionID = m_regions->getRegionID(Vec2ui(xIndex, yIndex));
+                m_residentTiles.push_front({ tileIndex, bits, false });
+                m_tileIndex[tileIndex] = m_residentTiles.begin();
 
-                    NodeData& node = getNode(Vec2ui(x, y));
-                    node.regionID = regionID;
+                while (m_residentTiles.size() > m_maxResidentTiles)
+                {
+                    ResidentTile& evictedTile = m_residentTiles.back();
+                    if (evictedTile.isDirty)
+                    {
+                        writeTile(evictedTile.tileIndex, *evictedTile.bits);
+                        m_numWriteBacks++;
+                    }
 
-                    m_regions->regions[regionID]->nodes.push_back(getIndex(node.pos));
+                    m_tileIndex.erase(evictedTile.tileIndex);
+                    m_residentTiles.pop_back();
+                    m_tileCacheStats.evictions++;
                 }
+
+                return bits;
             }
         }
 
         /**
-         * @brief Finds and stores the neighbors of each node within the NavMesh.
+         * @brief Gets a tile for a search, from the tiles the search holds on to if possible.
          *
-         * Done after generating or loading a NavMesh.
-         * It determines the neighbors of each node and stores them at `m_neighbors[nodeIndex]`.
-         * 
-         * Each node can have from 3 to 8 neighbours depending on its location within the NavMesh.
-         * All neighbours are considered: vertical, horizontal, and diagonal.
-         *
-         * @param nodeIndex The index of the node within the NavMesh.
+         * @param context The scratch memory of the search.
+         * @param tileIndex The index of the tile.
+         * @return const std::vector<uint64_t>* The bits of the tile, or `nullptr` if it could not be read.
          */
-        void setNeighbors(ui32 nodeIndex)
+        const std::vector<uint64_t>* getSearchTile(TiledPathSearchContext& context, ui32 tileIndex)
         {
-            NodeData& node = m_nodes[nodeIndex];
-            f32 x = node.pos.x;
-            f32 y = node.pos.y;
-
-            for (i32 v = -1; v <= 1; ++v)
+            ui32 slot = tileIndex % TiledPathSearchContext::NUM_CACHED_TILES;
+            if (context.m_cachedTiles[slot] == nullptr || context.m_cachedTileIndices[slot] != tileIndex)
             {
-                for (i32 u = -1; u <= 1; ++u)
-                {
-                    // Skip current node
-                    if (u == 0 && v == 0)
-                        continue;
-
-                    if (x + u >= 0 && y + v >= 0 &&
-                        x + u < m_width && y + v < m_height)
-                    {
-                        m_neighbors[nodeIndex].push_back(getIndex(Vec2ui(x + u, y + v)));
-                    }
-                }
+                context.m_cachedTiles[slot] = getTile(tileIndex, false);
+                context.m_cachedTileIndices[slot] = tileIndex;
             }
+
+            return context.m_cachedTiles[slot].get();
         }
 
         /**
-         * @brief Calculates the Manhattan distance between two Vec2ui objects.
+         * @brief Changes the walkability of a node within its resident tile.
          *
-         * @param v1 First Vec2ui object.
-         * @param v2 Second Vec2ui object.
-         * @return f32 The Manhattan distance between the Vec2ui objects.
+         * @param pos The position of the node.
+         * @param isWalkable `true` if the node becomes walkable, `false` otherwise.
          */
-        f32 manhattan(const Vec2ui& v1, const Vec2ui& v2)
+        void setState(const Vec2ui& pos, bool isWalkable)
         {
-            f32 distX = std::abs(static_cast<f32>(v1.x) - static_cast<f32>(v2.x));
-            f32 distY = std::abs(static_cast<f32>(v1.y) - static_cast<f32>(v2.y));
+            if (!isOpen() || !isValid(pos))
+                return;
 
-            return distX + distY;
+            ui32 tileIndex = getTileIndex(pos);
+            ui32 bit = getLocalBit(pos);
+
+            while (true)
+            {
+                if (!getTile(tileIndex, false))
+                    return;
+
+                std::lock_guard<std::mutex> lock(m_tileMutex);
+
+                // Another thread may have evicted the tile in between
+                auto it = m_tileIndex.find(tileIndex);
+                if (it == m_tileIndex.end())
+                    continue;
+
+                ResidentTile& tile = *it->second;
+                if (readBit(*tile.bits, bit) == isWalkable)
+                    return;
+
+                auto bits = std::make_shared<std::vector<uint64_t>>(*tile.bits);
+                (*bits)[bit / 64] ^= uint64_t(1) << (bit % 64);
+                tile.bits = bits;
+                tile.isDirty = true;
+                return;
+            }
         }
 
         /**
-         * @brief Calculates the Euclidean distance between two Vec2ui objects.
+         * @brief Reads a tile from the file.
          *
-         * @param v1 First Vec2ui object.
-         * @param v2 Second Vec2ui object.
-         * @return f32 The Euclidean distance between the Vec2ui objects.
+         * @param tileIndex The index of the tile.
+         * @param bits Receives the bits of the tile.
+         * @return `true` if the tile was read, `false` otherwise.
          */
-        f32 euclidean(const Vec2ui& v1, const Vec2ui& v2)
+        bool readTile(ui32 tileIndex, std::vector<uint64_t>& bits)
         {
-            f32 distX = static_cast<f32>(v1.x) - static_cast<f32>(v2.x);
-            f32 distY = static_cast<f32>(v1.y) - static_cast<f32>(v2.y);
-            f32 dist = std::pow(distX, 2) + std::pow(distY, 2);
+            std::lock_guard<std::mutex> lock(m_fileMutex);
 
-            return std::sqrt(dist);
+            m_file.seekg(m_tileOffset + static_cast<uint64_t>(tileIndex) * m_tileBytes);
+            if (!m_file.read(reinterpret_cast<char*>(bits.data()), bits.size() * sizeof(uint64_t)))
+            {
+                m_file.clear();
+                return false;
+            }
+
+            return true;
         }
 
         /**
-         * @brief Method to be called by each thread during geometric preprocessing.
+         * @brief Writes a tile to the file.
          *
-         * This method does the same thing as the `preprocess()` method, only that it is adapted to work for 
-         * individual threads.
-         *
-         * @param threadID The ID of the thread.
-         * @param numThreads The total number of threads used.
-         * @param nodes The NavMesh nodes. Each thread receives a copy of the nodes such that data racing is avoided.
-         * @param regionList The list of regions.
+         * @param tileIndex The index of the tile.
+         * @param bits The bits of the tile.
+         * @return `true` if the tile was written, `false` otherwise.
          */
-        void preprocessWorker(ui32 threadID, ui32 numThreads, std::vector<NodeData> nodes, std::vector<Region*> regionList)
+        bool writeTile(ui32 tileIndex, const std::vector<uint64_t>& bits)
         {
-            ui32 startIndex = threadID;
+            std::lock_guard<std::mutex> lock(m_fileMutex);
 
-            for (ui32 regionIndex = startIndex; regionIndex < regionList.size(); regionIndex += numThreads)
+            m_file.seekp(m_tileOffset + static_cast<uint64_t>(tileIndex) * m_tileBytes);
+            if (!m_file.write(reinterpret_cast<const char*>(bits.data()), bits.size() * sizeof(uint64_t)) || !m_file.flush())
             {
-                std::cout << "Preprocessing region " << regionIndex << "/" << regionList.size() << std::endl;
-                for (ui32 i = 0; i < regionList[regionIndex]->nodes.size(); i++)
-                {
-                    ui32 nodeIndex = regionList[regionIndex]->nodes[i];
-
-                    if (nodes[nodeIndex].state == NodeState::OBSTRUCTABLE)
-                        continue;
-
-                    for (Region* R : regionList)
-                    {
-                        if (nodes[nodeIndex].regionID == R->regionID)
-                            continue;
-
-                        std::vector<std::vector<Vec2ui>> paths;
-
-                        // Calculate distances from node N to all nodes in region R
-                        for (ui32 O_tentative : R->nodes)
-                        {
-                            std::vector<NodeData> nodes = m_nodes;
-                            std::vector<Vec2ui> path = AStar(nodes[nodeIndex].pos, nodes[O_tentative].pos, nodes);
+                m_file.clear();
+                return false;
+            }
 
-                            if (path.size() > 0)
-                            {
-                                paths.push_back(path);
-                            }
-                        }
+            m_tileCacheStats.writeBacks++;
+            return true;
+        }
 
-                        // No paths found
-                        if (paths.size() == 0)
-                        {
-                            continue;
-                        }
+        /**
+         * @brief Queues tiles for the background loader.
+         *
+         * @param tileIndices The indices of the tiles, the most urgent first.
+         */
+        void requestTiles(const std::vector<ui32>& tileIndices)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_loaderMutex);
 
-                        // Find most optimal path from node N to region R
-                        ui32 bestPathIndex = 0;
-                        for (ui32 j = 1; j < paths.size(); j++)
-                        {
-                            if (paths[j].size() < paths[bestPathIndex].size())
-                            {
-                                bestPathIndex = j;
-                            }
-                        }
+                for (ui32 tileIndex : tileIndices)
+                {
+                    if (std::find(m_loadQueue.begin(), m_loadQueue.end(), tileIndex) == m_loadQueue.end())
+                        m_loadQueue.push_back(tileIndex);
+                }
 
-                        // Add best path to region R to the node N
-                        m_adjList[nodeIndex][R->regionID] = paths[bestPathIndex];
-                    }
+                while (m_loadQueue.size() > m_maxResidentTiles)
+                {
+                    m_loadQueue.pop_front();
                 }
             }
+            m_loaderWake.notify_one();
         }
 
         /**
-         * @brief The A* algorithm. Finds the shortest path between two nodes.
+         * @brief Queues the tiles along the straight line between two nodes for the background loader.
+         *
+         * The line is sampled every half tile, which visits each tile it crosses. At most half of the cache is 
+         * requested, so that the prefetched tiles do not push out the ones the search starts with.
          *
          * @param start The position of the start node.
          * @param target The position of the target node.
-         * @param nodes The nodes of the NavMesh.
-         * @return std::vector<Vec2ui> The shortest path between the start and the target nodes.
          */
-        std::vector<Vec2ui> AStar(Vec2ui start, Vec2ui target, std::vector<NodeData>& nodes)
+        void prefetchLine(const Vec2ui& start, const Vec2ui& target)
         {
-            std::vector<ui32> parents(nodes.size(), -1);
-            std::priority_queue<NodeData, std::vector<NodeData>, NodeDataComparator> openSet;
+            if (getTileIndex(start) == getTileIndex(target))
+                return;
 
-            for (NodeData& node : nodes)
-            {
-                node.g = INFINITY;
-                node.h = INFINITY;
-            }
+            f32 dx = static_cast<f32>(target.x) - static_cast<f32>(start.x);
+            f32 dy = static_cast<f32>(target.y) - static_cast<f32>(start.y);
+            ui32 numSamples = static_cast<ui32>(std::max(std::abs(dx), std::abs(dy)) / (m_tileSize * 0.5f)) + 1;
 
-            ui32 startNodeIndex = getIndex(start);
-            ui32 targetNodeIndex = getIndex(target);
+            std::vector<ui32> tileIndices;
+            for (ui32 i = 1; i <= numSamples && tileIndices.size() < std::max(m_maxResidentTiles / 2, 1u); i++)
+            {
+                f32 t = static_cast<f32>(i) / numSamples;
+                Vec2ui pos(static_cast<ui32>(start.x + dx * t + 0.5f), static_cast<ui32>(start.y + dy * t + 0.5f));
 
-            nodes[startNodeIndex].g = 0.0f;
+                ui32 tileIndex = getTileIndex(pos);
+                if (tileIndex != getTileIndex(start) && (tileIndices.empty() || tileIndices.back() != tileIndex))
+                    tileIndices.push_back(tileIndex);
+            }
 
-            openSet.push(nodes[startNodeIndex]);
+            requestTiles(tileIndices);
+        }
 
-            while (openSet.size() > 0)
+        /**
+         * @brief Loads the queued tiles until the navigation mesh is destroyed. Runs on the loader thread.
+         *
+         */
+        void loadLoop()
+        {
+            while (true)
             {
-                ui32 currentIndex = getIndex(openSet.top().pos);
-
-                while (openSet.size() > 0 && currentIndex == getIndex(openSet.top().pos))
-                {
-                    openSet.pop();
-                }
-
-                if (currentIndex == targetNodeIndex)
+                ui32 tileIndex;
                 {
-                    std::vector<Vec2ui> shortestPath;
+                    std::unique_lock<std::mutex> lock(m_loaderMutex);
+                    m_loaderWake.wait(lock, [this]() { return m_stopLoading || !m_loadQueue.empty(); });
 
-                    while (currentIndex != -1)
-                    {
-                        shortestPath.push_back(nodes[currentIndex].pos);
-                        currentIndex = parents[currentIndex];
-                    }
+                    if (m_stopLoading)
+                        return;
 
-                    std::reverse(shortestPath.begin(), shortestPath.end());
-                    return shortestPath;
+                    tileIndex = m_loadQueue.front();
+                    m_loadQueue.pop_front();
                 }
 
-                for (ui32 neighborIndex : m_neighbors[currentIndex])
-                {
-                    NodeData& neighbor = nodes[neighborIndex];
-                    if (neighbor.state == NodeState::OBSTRUCTABLE)
-                        continue;
+                getTile(tileIndex, true);
+            }
+        }
 
-                    f32 tentativeG = nodes[currentIndex].g + euclidean(neighbor.pos, nodes[currentIndex].pos);
+        /**
+         * @brief Resets a search context for a new query.
+         *
+         * The blocks and the tiles of the previous query are dropped, but the memory of the blocks is kept.
+         *
+         * @param context The scratch memory of the search.
+         */
+        void beginQuery(TiledPathSearchContext& context) const
+        {
+            context.m_blocks.clear();
+            context.m_blockTiles.clear();
+            context.m_g.clear();
+            context.m_parents.clear();
+            context.m_closed.clear();
+            context.m_openSet.clear(0);
+            context.m_numClosed = 0;
+            context.m_lastTile = INVALID_INDEX;
+            context.m_lastBlock = INVALID_INDEX;
+
+            for (auto& tile : context.m_cachedTiles)
+            {
+                tile = nullptr;
+            }
+        }
 
-                    if (tentativeG < neighbor.g)
-                    {
-                        parents[neighborIndex] = getIndex(nodes[currentIndex].pos);
-                        neighbor.g = tentativeG;
-                        neighbor.h = euclidean(neighbor.pos, nodes[targetNodeIndex].pos);
+        /**
+         * @brief Gets the index of a node within the scratch memory of a search, allocating a block for its tile if 
+         * the search has not reached the tile yet.
+         *
+         * @param context The scratch memory of the search.
+         * @param tileIndex The index of the tile of the node.
+         * @param localBit The index of the node within its tile.
+         * @return ui32 The local index of the node.
+         */
+        ui32 getLocalIndex(TiledPathSearchContext& context, ui32 tileIndex, ui32 localBit) const
+        {
+            ui32 tileArea = m_tileSize * m_tileSize;
 
-                        openSet.push(nodes[neighborIndex]);
-                    }
+            if (tileIndex != context.m_lastTile)
+            {
+                auto [it, isNew] = context.m_blocks.try_emplace(tileIndex, static_cast<ui32>(context.m_blockTiles.size()));
+                if (isNew)
+                {
+                    context.m_blockTiles.push_back(tileIndex);
+                    context.m_g.resize(context.m_g.size() + tileArea, INFINITY);
+                    context.m_parents.resize(context.m_parents.size() + tileArea, INVALID_INDEX);
+                    context.m_closed.resize(context.m_closed.size() + tileArea, 0);
+                    context.m_openSet.reserve(static_cast<ui32>(context.m_g.size()));
                 }
+
+                context.m_lastTile = tileIndex;
+                context.m_lastBlock = it->second;
             }
 
-            return {};
+            return context.m_lastBlock * tileArea + localBit;
         }
 
-    private:
-        bool m_isPreprocessed = false;                                          /*!< Indicates whether geometric preprocessing has been performed. */
-        ui32 m_width, m_height;                                                 /*!< Width and height of the navigation mesh. */
-        RegionList* m_regions;                                                  /*!< The list of regions. */
-        std::vector<NodeData> m_nodes;                                          /*!< The nodes of the navigation mesh. */
-        std::vector<std::vector<ui32>> m_neighbors;                             /*!< The list of the nodes' neighbors. */
-        std::vector<std::unordered_map<ui32, std::vector<Vec2ui>>> m_adjList;   /*!< The list of all preprocessed paths from each node to each region. */
+        /**
+         * @brief Gets the position of a node from its index within the scratch memory of a search.
+         *
+         * @param context The scratch memory of the search.
+         * @param localIndex The local index of the node.
+         * @return Vec2ui The position of the node.
+         */
+        Vec2ui getPosition(const TiledPathSearchContext& context, ui32 localIndex) const
+        {
+            ui32 tileArea = m_tileSize * m_tileSize;
+            ui32 tileIndex = context.m_blockTiles[localIndex / tileArea];
+            ui32 localBit = localIndex % tileArea;
+
+            return Vec2ui(tileIndex % m_numTilesX * m_tileSize + localBit % m_tileSize, tileIndex / m_numTilesX * m_tileSize + localBit / m_tileSize);
+        }
+
+        ui32 m_width = 0, m_height = 0;             /*!< Width and height of the navigation mesh. */
+        ui32 m_tileSize = 0;                        /*!< The width and height of a tile; 0 if no file is open. */
+        ui32 m_numTilesX = 0;                       /*!< The number of tiles on the `x` axis. */
+        uint64_t m_tileBytes = 0;                   /*!< The size of a tile within the file in bytes. */
+        uint64_t m_tileOffset = 0;                  /*!< The offset of the first tile from the start of the file. */
+        ui32 m_maxResidentTiles;                    /*!< The maximum number of tiles kept in memory. */
+
+        std::fstream m_file;                        /*!< The file the tiles are read from and written to. */
+        std::mutex m_fileMutex;                     /*!< Guards the read and write position of `m_file`. */
+
+        std::list<ResidentTile> m_residentTiles;                                /*!< The resident tiles, the most recently used first. */
+        std::unordered_map<ui32, std::list<ResidentTile>::iterator> m_tileIndex; /*!< The resident tiles by tile index. */
+        uint64_t m_numWriteBacks = 0;                                           /*!< The number of tiles written back on eviction; detects outdated reads. */
+        TileCacheStats m_tileCacheStats;                                        /*!< The hit and miss statistics of the tile cache. */
+        std::mutex m_tileMutex;                                                 /*!< Guards the resident tiles and the statistics. */
+
+        std::thread m_loaderThread;                 /*!< Loads prefetched tiles in the background. */
+        std::deque<ui32> m_loadQueue;               /*!< The tiles waiting to be loaded, the oldest request first. */
+        bool m_stopLoading = false;                 /*!< Set to stop the loader thread. */
+        std::mutex m_loaderMutex;                   /*!< Guards the load queue. */
+        std::condition_variable m_loaderWake;       /*!< Wakes the loader thread when tiles are requested. */
+
+        TiledPathSearchContext m_searchContext;     /*!< The scratch memory of queries without a caller-owned context. */
     };
 
     class State;